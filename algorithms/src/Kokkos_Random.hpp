@@ -1149,6 +1149,366 @@ class Random_XorShift1024_Pool {
   }
 };
 
+//----------------------------------------------------------------------------
+// Counter-based generators (Salmon et al., "Parallel Random Numbers: As Easy
+// as 1, 2, 3", SC'11).  The output is a keyed bijection of a counter, so a
+// generator is fully described by (seed, stream, position): there is no
+// state to store in the pool and nothing to lock.  Drawing from
+// pool.get_state(i) gives the same numbers on every backend and for any
+// number of threads.
+
+namespace Impl {
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint32_t random_rotl32(const uint32_t x, const int r) {
+  return (x << r) | (x >> (32 - r));
+}
+
+/// Philox4x32-10: four 32-bit counter words, two 32-bit key words.
+///
+/// apply_lanes() runs the bijection on N independent counters laid out
+/// word-major (ctr[word][lane]); the lane loops have no dependencies and
+/// vectorize on the host.
+struct Random_Philox4x32_Bijection {
+  template <int N>
+  KOKKOS_INLINE_FUNCTION static void apply_lanes(uint32_t (&ctr)[4][N],
+                                                 const uint32_t key[2]) {
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    for (int round = 0; round < 10; ++round) {
+      for (int l = 0; l < N; ++l) {
+        const uint64_t p0 = static_cast<uint64_t>(0xD2511F53U) * ctr[0][l];
+        const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57U) * ctr[2][l];
+        ctr[0][l] = static_cast<uint32_t>(p1 >> 32) ^ ctr[1][l] ^ k0;
+        ctr[1][l] = static_cast<uint32_t>(p1);
+        ctr[2][l] = static_cast<uint32_t>(p0 >> 32) ^ ctr[3][l] ^ k1;
+        ctr[3][l] = static_cast<uint32_t>(p0);
+      }
+      k0 += 0x9E3779B9U;
+      k1 += 0xBB67AE85U;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void apply(uint32_t ctr[4], const uint32_t key[2]) {
+    uint32_t c[4][1] = {{ctr[0]}, {ctr[1]}, {ctr[2]}, {ctr[3]}};
+    apply_lanes(c, key);
+    for (int i = 0; i < 4; ++i) ctr[i] = c[i][0];
+  }
+};
+
+/// Threefry4x32-20: four 32-bit counter words, key words 0 and 1 taken
+/// from the seed and words 2 and 3 zero.
+struct Random_Threefry4x32_Bijection {
+  template <int N>
+  KOKKOS_INLINE_FUNCTION static void apply_lanes(uint32_t (&ctr)[4][N],
+                                                 const uint32_t key[2]) {
+    // rotation constants of rounds 0-7, flattened as {r0, r1} pairs
+    const int rot[16] = {10, 26, 11, 21, 13, 27, 23, 5,
+                         6,  20, 17, 11, 25, 10, 18, 20};
+    const uint32_t ks[5] = {key[0], key[1], 0u, 0u,
+                            0x1BD11BDAU ^ key[0] ^ key[1]};
+    for (int i = 0; i < 4; ++i)
+      for (int l = 0; l < N; ++l) ctr[i][l] += ks[i];
+    // five groups of four rounds, each followed by a key injection; even
+    // rounds mix (0,1),(2,3) and odd rounds (0,3),(2,1)
+    for (int inject = 1; inject <= 5; ++inject) {
+      const int* r = rot + 8 * ((inject - 1) % 2);
+      for (int l = 0; l < N; ++l) {
+        uint32_t x0 = ctr[0][l], x1 = ctr[1][l], x2 = ctr[2][l],
+                 x3 = ctr[3][l];
+        x0 += x1;
+        x1 = random_rotl32(x1, r[0]) ^ x0;
+        x2 += x3;
+        x3 = random_rotl32(x3, r[1]) ^ x2;
+        x0 += x3;
+        x3 = random_rotl32(x3, r[2]) ^ x0;
+        x2 += x1;
+        x1 = random_rotl32(x1, r[3]) ^ x2;
+        x0 += x1;
+        x1 = random_rotl32(x1, r[4]) ^ x0;
+        x2 += x3;
+        x3 = random_rotl32(x3, r[5]) ^ x2;
+        x0 += x3;
+        x3 = random_rotl32(x3, r[6]) ^ x0;
+        x2 += x1;
+        x1 = random_rotl32(x1, r[7]) ^ x2;
+        ctr[0][l] = x0 + ks[inject % 5];
+        ctr[1][l] = x1 + ks[(inject + 1) % 5];
+        ctr[2][l] = x2 + ks[(inject + 2) % 5];
+        ctr[3][l] = x3 + ks[(inject + 3) % 5] + inject;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void apply(uint32_t ctr[4], const uint32_t key[2]) {
+    uint32_t c[4][1] = {{ctr[0]}, {ctr[1]}, {ctr[2]}, {ctr[3]}};
+    apply_lanes(c, key);
+    for (int i = 0; i < 4; ++i) ctr[i] = c[i][0];
+  }
+};
+
+template <class Bijection, class DeviceType>
+class Random_CounterBased_Pool;
+
+/// Generator producing the stream (seed, stream) block by block.  Each
+/// block is one application of the bijection to the 128-bit counter
+/// (position, stream) and yields four 32-bit words.
+template <class Bijection, class DeviceType>
+class Random_CounterBased {
+ private:
+  uint32_t key_[2];
+  uint32_t ctr_[4];
+  uint32_t out_[4];
+  int next_;
+
+  KOKKOS_INLINE_FUNCTION
+  void refill() {
+    for (int i = 0; i < 4; ++i) out_[i] = ctr_[i];
+    Bijection::apply(out_, key_);
+    if (++ctr_[0] == 0) ++ctr_[1];
+    next_ = 0;
+  }
+
+ public:
+  using pool_type   = Random_CounterBased_Pool<Bijection, DeviceType>;
+  using device_type = DeviceType;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  /// Start the stream \c stream of \c seed at block \c position.
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased(uint64_t seed, uint64_t stream, uint64_t position = 0)
+      : next_(4) {
+    key_[0] = static_cast<uint32_t>(seed);
+    key_[1] = static_cast<uint32_t>(seed >> 32);
+    ctr_[0] = static_cast<uint32_t>(position);
+    ctr_[1] = static_cast<uint32_t>(position >> 32);
+    ctr_[2] = static_cast<uint32_t>(stream);
+    ctr_[3] = static_cast<uint32_t>(stream >> 32);
+  }
+
+  /// Skip ahead \c blocks blocks of four 32-bit words in O(1).
+  KOKKOS_INLINE_FUNCTION
+  void advance(uint64_t blocks) {
+    uint64_t position =
+        (static_cast<uint64_t>(ctr_[1]) << 32 | ctr_[0]) + blocks;
+    ctr_[0] = static_cast<uint32_t>(position);
+    ctr_[1] = static_cast<uint32_t>(position >> 32);
+    next_   = 4;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() {
+    if (next_ == 4) refill();
+    return out_[next_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    const uint64_t lo = urand();
+    return (static_cast<uint64_t>(urand()) << 32) | lo;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  // The floating point draws use exactly as many random bits as the
+  // mantissa holds, so the results are in [0,1) and identical everywhere.
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return (urand() >> 8) * (1.0f / 16777216.0f); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) { return range * frand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return (urand64() >> 11) * (1.0 / 9007199254740992.0); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) { return range * drand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Marsaglia polar method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+    double S = 2.0;
+    double U;
+    while (S >= 1.0 || S == 0.0) {
+      U              = 2.0 * drand() - 1.0;
+      const double V = 2.0 * drand() - 1.0;
+      S              = U * U + V * V;
+    }
+    return U * std::sqrt(-2.0 * std::log(S) / S);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+};
+
+/// The pool only stores the seed.  get_state(stream) is free of locks and
+/// atomics and reproducible; get_state() hands out a fresh stream with a
+/// single atomic increment so existing pool-based code keeps working.
+template <class Bijection, class DeviceType>
+class Random_CounterBased_Pool {
+ private:
+  using execution_space = typename DeviceType::execution_space;
+  using counter_type    = View<uint64_t, DeviceType>;
+
+  uint64_t seed_;
+  counter_type next_stream_;
+
+  struct reserve_streams_functor {
+    counter_type next_stream;
+    uint64_t count;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(int, uint64_t& base) const {
+      base += Kokkos::atomic_fetch_add(&next_stream(), count);
+    }
+  };
+
+ public:
+  using generator_type = Random_CounterBased<Bijection, DeviceType>;
+  using device_type    = DeviceType;
+
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased_Pool() : seed_(0) {}
+
+  Random_CounterBased_Pool(uint64_t seed) : seed_(0) { init(seed); }
+
+  /// \c num_states is accepted for interface compatibility and ignored.
+  void init(uint64_t seed, int /*num_states*/ = 0) {
+    seed_ = seed;
+    next_stream_ =
+        counter_type("Kokkos::Random_CounterBased::next_stream");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t seed() const { return seed_; }
+
+  /// Draw from an anonymous stream; unique per call, not reproducible.
+  /// Anonymous streams count down from the top of the stream range so
+  /// they do not collide with small explicit stream indices.
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state() const {
+    const uint64_t stream = Kokkos::atomic_fetch_add(&next_stream_(), 1);
+    return generator_type(seed_, ~stream);
+  }
+
+  /// Draw from stream \c stream.  Any number of threads may use the same
+  /// stream index; they simply see the same numbers.
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state(const uint64_t stream) const {
+    return generator_type(seed_, stream);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const generator_type&) const {}
+
+  /// Reserve \c count consecutive anonymous streams and return the index
+  /// of the first; stream k of the block is generated by ~(first + k).
+  /// The block is disjoint from every stream get_state() hands out.
+  uint64_t reserve_streams(const uint64_t count) const {
+    uint64_t first = 0;
+    parallel_reduce("Kokkos::Random_CounterBased::reserve_streams",
+                    RangePolicy<execution_space>(0, 1),
+                    reserve_streams_functor{next_stream_, count}, first);
+    return first;
+  }
+};
+
+}  // namespace Impl
+
+template <class DeviceType>
+using Random_Philox4x32 =
+    Impl::Random_CounterBased<Impl::Random_Philox4x32_Bijection, DeviceType>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32_Pool =
+    Impl::Random_CounterBased_Pool<Impl::Random_Philox4x32_Bijection,
+                                   DeviceType>;
+
+template <class DeviceType>
+using Random_Threefry4x32 =
+    Impl::Random_CounterBased<Impl::Random_Threefry4x32_Bijection,
+                              DeviceType>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry4x32_Pool =
+    Impl::Random_CounterBased_Pool<Impl::Random_Threefry4x32_Bijection,
+                                   DeviceType>;
+
 namespace Impl {
 
 template <class ViewType, class RandomPool, int loops, int rank,
@@ -1681,9 +2041,11 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
 
 }  // namespace Impl
 
-template <class ViewType, class RandomPool, class IndexType = int64_t>
-void fill_random(ViewType a, RandomPool g,
-                 typename ViewType::const_value_type range) {
+namespace Impl {
+
+template <class IndexType, class ViewType, class RandomPool>
+void fill_random_generic(ViewType a, RandomPool g,
+                         typename ViewType::const_value_type range) {
   int64_t LDA = a.extent(0);
   if (LDA > 0)
     parallel_for("Kokkos::fill_random", (LDA + 127) / 128,
@@ -1692,10 +2054,10 @@ void fill_random(ViewType a, RandomPool g,
                      a, g, range));
 }
 
-template <class ViewType, class RandomPool, class IndexType = int64_t>
-void fill_random(ViewType a, RandomPool g,
-                 typename ViewType::const_value_type begin,
-                 typename ViewType::const_value_type end) {
+template <class IndexType, class ViewType, class RandomPool>
+void fill_random_generic(ViewType a, RandomPool g,
+                         typename ViewType::const_value_type begin,
+                         typename ViewType::const_value_type end) {
   int64_t LDA = a.extent(0);
   if (LDA > 0)
     parallel_for("Kokkos::fill_random", (LDA + 127) / 128,
@@ -1703,6 +2065,486 @@ void fill_random(ViewType a, RandomPool g,
                                                      ViewType::Rank, IndexType>(
                      a, g, begin, end));
 }
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+// Distributions.  These work with any generator of this file; all of them
+// turn raw 32/64-bit draws into [0,1) with exactly as many bits as the
+// mantissa holds, so log(1 - u) is always finite.
+
+namespace Impl {
+
+template <class Scalar>
+struct random_uniform_bits;
+
+template <>
+struct random_uniform_bits<float> {
+  enum : int { words = 1 };
+  KOKKOS_FORCEINLINE_FUNCTION
+  static float apply(const uint32_t* w) {
+    return (w[0] >> 8) * (1.0f / 16777216.0f);
+  }
+  template <class Generator>
+  KOKKOS_FORCEINLINE_FUNCTION static float draw(Generator& gen) {
+    const uint32_t w = gen.urand();
+    return apply(&w);
+  }
+};
+
+template <>
+struct random_uniform_bits<double> {
+  enum : int { words = 2 };
+  KOKKOS_FORCEINLINE_FUNCTION
+  static double apply(const uint32_t* w) {
+    return ((static_cast<uint64_t>(w[1]) << 32 | w[0]) >> 11) *
+           (1.0 / 9007199254740992.0);
+  }
+  template <class Generator>
+  KOKKOS_FORCEINLINE_FUNCTION static double draw(Generator& gen) {
+    return (gen.urand64() >> 11) * (1.0 / 9007199254740992.0);
+  }
+};
+
+// A distribution consumes `words` raw 32-bit words (bulk path) or draws
+// from a generator, and produces `values` results at a time.
+
+template <class Scalar>
+struct random_uniform_distribution {
+  using uniform = random_uniform_bits<Scalar>;
+  enum : int { words = uniform::words, values = 1 };
+  Scalar start, range;
+
+  KOKKOS_INLINE_FUNCTION
+  void apply(const uint32_t* w, Scalar* out) const {
+    out[0] = start + range * uniform::apply(w);
+  }
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void draw(Generator& gen, Scalar* out) const {
+    out[0] = start + range * uniform::draw(gen);
+  }
+};
+
+// Box-Muller: branch free, two normals per pair of uniforms.
+template <class Scalar>
+struct random_normal_distribution {
+  using uniform = random_uniform_bits<Scalar>;
+  enum : int { words = 2 * uniform::words, values = 2 };
+  Scalar mean, std_dev;
+
+  KOKKOS_INLINE_FUNCTION
+  void transform(const Scalar u1, const Scalar u2, Scalar* out) const {
+    const Scalar r = std::sqrt(Scalar(-2) * std::log(Scalar(1) - u1));
+    const Scalar theta = Scalar(6.283185307179586476925) * u2;
+    out[0]             = mean + std_dev * r * std::cos(theta);
+    out[1]             = mean + std_dev * r * std::sin(theta);
+  }
+  KOKKOS_INLINE_FUNCTION
+  void apply(const uint32_t* w, Scalar* out) const {
+    transform(uniform::apply(w), uniform::apply(w + uniform::words), out);
+  }
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void draw(Generator& gen, Scalar* out) const {
+    const Scalar u1 = uniform::draw(gen);
+    transform(u1, uniform::draw(gen), out);
+  }
+};
+
+template <class Scalar>
+struct random_exponential_distribution {
+  using uniform = random_uniform_bits<Scalar>;
+  enum : int { words = uniform::words, values = 1 };
+  Scalar rate;
+
+  KOKKOS_INLINE_FUNCTION
+  void apply(const uint32_t* w, Scalar* out) const {
+    out[0] = -std::log(Scalar(1) - uniform::apply(w)) / rate;
+  }
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION void draw(Generator& gen, Scalar* out) const {
+    out[0] = -std::log(Scalar(1) - uniform::draw(gen)) / rate;
+  }
+};
+
+}  // namespace Impl
+
+/// Standard normal draws via Box-Muller.  Unlike Generator::normal() there
+/// is no rejection loop, so calls in a vector lane or warp do not diverge.
+template <class Generator, class Scalar>
+struct rand_normal {
+  KOKKOS_INLINE_FUNCTION
+  static Scalar draw(Generator& gen, const Scalar& mean = Scalar(0),
+                     const Scalar& std_dev = Scalar(1)) {
+    Scalar z[2];
+    Impl::random_normal_distribution<Scalar>{mean, std_dev}.draw(gen, z);
+    return z[0];
+  }
+
+  /// Both normals of one Box-Muller pair.
+  KOKKOS_INLINE_FUNCTION
+  static void draw(Generator& gen, Scalar& z0, Scalar& z1,
+                   const Scalar& mean = Scalar(0),
+                   const Scalar& std_dev = Scalar(1)) {
+    Scalar z[2];
+    Impl::random_normal_distribution<Scalar>{mean, std_dev}.draw(gen, z);
+    z0 = z[0];
+    z1 = z[1];
+  }
+};
+
+/// Exponential draws with the given rate (mean 1 / rate) by inversion.
+template <class Generator, class Scalar>
+struct rand_exponential {
+  KOKKOS_INLINE_FUNCTION
+  static Scalar draw(Generator& gen, const Scalar& rate = Scalar(1)) {
+    Scalar x;
+    Impl::random_exponential_distribution<Scalar>{rate}.draw(gen, &x);
+    return x;
+  }
+};
+
+/// Poisson draws: inversion by sequential search for small means and the
+/// transformed rejection method PTRS (Hoermann 1993) for mean >= 10.
+template <class Generator, class Scalar>
+struct rand_poisson {
+  KOKKOS_INLINE_FUNCTION
+  static Scalar draw(Generator& gen, const double& mean) {
+    using uniform = Impl::random_uniform_bits<double>;
+    if (mean < 10.0) {
+      double p       = std::exp(-mean);
+      double s       = p;
+      const double u = uniform::draw(gen);
+      Scalar k       = 0;
+      // Stop once p underflows; the remaining tail mass is negligible.
+      while (u > s && p > 0.0) {
+        ++k;
+        p *= mean / k;
+        s += p;
+      }
+      return k;
+    }
+    const double smu      = std::sqrt(mean);
+    const double b        = 0.931 + 2.53 * smu;
+    const double a        = -0.059 + 0.02483 * b;
+    const double invalpha = 1.1239 + 1.1328 / (b - 3.4);
+    const double vr       = 0.9277 - 3.6224 / (b - 2.0);
+    const double log_mean = std::log(mean);
+    while (true) {
+      const double U  = uniform::draw(gen) - 0.5;
+      const double V  = uniform::draw(gen);
+      const double us = 0.5 - (U < 0.0 ? -U : U);
+      const double k  = std::floor((2.0 * a / us + b) * U + mean + 0.43);
+      if (us >= 0.07 && V <= vr) return static_cast<Scalar>(k);
+      if (k < 0.0 || (us < 0.013 && V > us)) continue;
+      if (std::log(V) + std::log(invalpha) - std::log(a / (us * us) + b) <=
+          -mean + k * log_mean - std::lgamma(k + 1.0))
+        return static_cast<Scalar>(k);
+    }
+  }
+};
+
+/// Standard normal draws with the Marsaglia-Tsang ziggurat (128 layers).
+/// The layer table lives in DeviceType memory, so construct this on the
+/// host and copy it into kernels.  About 98.8% of draws cost one 64-bit
+/// random number, a table lookup and a compare.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_Normal_Ziggurat {
+ public:
+  using device_type = DeviceType;
+  enum : int { layers = 128 };
+
+ private:
+  using table_type =
+      View<const double[layers + 1], DeviceType, MemoryTraits<RandomAccess> >;
+  table_type x_;  // layer edges, x_[0] > x_[1] = r > ... > x_[128] = 0
+  table_type f_;  // exp(-x^2 / 2) at the edges
+
+  // right edge of the base layer, where the tail starts
+  KOKKOS_INLINE_FUNCTION
+  static constexpr double tail_start() { return 3.442619855899; }
+
+ public:
+  Random_Normal_Ziggurat() {
+    View<double[layers + 1], DeviceType> x("Kokkos::Random_Normal_Ziggurat::x");
+    View<double[layers + 1], DeviceType> f("Kokkos::Random_Normal_Ziggurat::f");
+    auto h_x = create_mirror_view(x);
+    auto h_f = create_mirror_view(f);
+
+    const double r = tail_start();
+    const double v = 9.91256303526217e-3;  // area of each layer
+    h_x(0)         = v / std::exp(-0.5 * r * r);
+    h_x(1)         = r;
+    for (int i = 1; i < layers - 1; ++i) {
+      h_x(i + 1) = std::sqrt(-2.0 * std::log(v / h_x(i) +
+                                             std::exp(-0.5 * h_x(i) * h_x(i))));
+    }
+    h_x(layers) = 0.0;
+    for (int i = 0; i <= layers; ++i) h_f(i) = std::exp(-0.5 * h_x(i) * h_x(i));
+
+    deep_copy(x, h_x);
+    deep_copy(f, h_f);
+    x_ = x;
+    f_ = f;
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double draw(Generator& gen) const {
+    using uniform = Impl::random_uniform_bits<double>;
+    while (true) {
+      const uint64_t bits = gen.urand64();
+      const int i         = static_cast<int>(bits & (layers - 1));
+      // the remaining 53 bits give u in [-1, 1)
+      const double u = 2.0 * ((bits >> 11) * (1.0 / 9007199254740992.0)) - 1.0;
+      const double x = u * x_(i);
+      if ((u < 0.0 ? -u : u) * x_(i) < x_(i + 1)) return x;
+      if (i == 0) {
+        // tail beyond r
+        const double r = tail_start();
+        double a, b;
+        do {
+          a = -std::log(1.0 - uniform::draw(gen)) / r;
+          b = -std::log(1.0 - uniform::draw(gen));
+        } while (2.0 * b < a * a);
+        return u < 0.0 ? -(r + a) : r + a;
+      }
+      if (f_(i + 1) + uniform::draw(gen) * (f_(i) - f_(i + 1)) <
+          std::exp(-0.5 * x * x))
+        return x;
+    }
+  }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double draw(Generator& gen, const double& mean,
+                                     const double& std_dev = 1.0) const {
+    return mean + std_dev * draw(gen);
+  }
+};
+
+namespace Impl {
+
+/// Fill the span of a contiguous View from any pool: one generator per
+/// chunk of entries.
+template <class ViewType, class RandomPool, class Distribution>
+struct fill_random_distribution_functor {
+  using execution_space = typename ViewType::execution_space;
+  using value_type      = typename ViewType::non_const_value_type;
+  enum : int64_t { chunk = 1024 };
+
+  value_type* data;
+  int64_t span;
+  RandomPool rand_pool;
+  Distribution dist;
+
+  fill_random_distribution_functor(ViewType a, RandomPool rand_pool_,
+                                   Distribution dist_)
+      : data(a.data()), span(a.span()), rand_pool(rand_pool_), dist(dist_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int64_t c) const {
+    typename RandomPool::generator_type gen = rand_pool.get_state();
+    const int64_t end = (c + 1) * chunk < span ? (c + 1) * chunk : span;
+    value_type tmp[Distribution::values];
+    for (int64_t n = c * chunk; n < end; n += Distribution::values) {
+      dist.draw(gen, tmp);
+      for (int v = 0; v < Distribution::values && n + v < end; ++v)
+        data[n + v] = tmp[v];
+    }
+    rand_pool.free_state(gen);
+  }
+};
+
+/// Bulk fill for counter-based pools.  Each fill reserves one anonymous
+/// stream of the pool per chunk, so consecutive fills and kernels drawing
+/// from the same pool never share numbers; within a chunk, `lanes` counter
+/// blocks are generated at once with the lane-parallel bijection and
+/// converted in a tight loop.
+template <class ViewType, class Bijection, class DeviceType,
+          class Distribution>
+struct fill_random_counter_based_functor {
+  using execution_space = typename ViewType::execution_space;
+  using value_type      = typename ViewType::non_const_value_type;
+  enum : int { lanes = 8, batch_words = 4 * lanes };
+  enum : int {
+    batch_values = (batch_words / Distribution::words) * Distribution::values
+  };
+  enum : int64_t { chunk = 4096 };
+
+  static_assert(batch_words % Distribution::words == 0,
+                "Distribution must consume a divisor of the batch size");
+
+  value_type* data;
+  int64_t span;
+  uint64_t seed;
+  uint64_t first_stream;
+  Distribution dist;
+
+  fill_random_counter_based_functor(
+      ViewType a, Random_CounterBased_Pool<Bijection, DeviceType> rand_pool,
+      Distribution dist_)
+      : data(a.data()),
+        span(a.span()),
+        seed(rand_pool.seed()),
+        first_stream(
+            rand_pool.reserve_streams((a.span() + chunk - 1) / chunk)),
+        dist(dist_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int64_t c) const {
+    const uint32_t key[2] = {static_cast<uint32_t>(seed),
+                             static_cast<uint32_t>(seed >> 32)};
+    const int64_t end = (c + 1) * chunk < span ? (c + 1) * chunk : span;
+    const uint64_t stream = ~(first_stream + static_cast<uint64_t>(c));
+    uint32_t ctr[4][lanes];
+    uint32_t words[batch_words];
+    value_type tmp[batch_values];
+
+    uint64_t block = 0;
+    for (int64_t n = c * chunk; n < end; block += lanes) {
+      for (int l = 0; l < lanes; ++l) {
+        ctr[0][l] = static_cast<uint32_t>(block + l);
+        ctr[1][l] = static_cast<uint32_t>((block + l) >> 32);
+        ctr[2][l] = static_cast<uint32_t>(stream);
+        ctr[3][l] = static_cast<uint32_t>(stream >> 32);
+      }
+      Bijection::apply_lanes(ctr, key);
+      for (int l = 0; l < lanes; ++l)
+        for (int w = 0; w < 4; ++w) words[4 * l + w] = ctr[w][l];
+
+      value_type* const out = end - n >= batch_values ? data + n : tmp;
+      for (int q = 0; q < batch_words / Distribution::words; ++q)
+        dist.apply(words + q * Distribution::words,
+                   out + q * Distribution::values);
+      if (out == tmp) {
+        for (int v = 0; n + v < end; ++v) data[n + v] = tmp[v];
+        n = end;
+      } else {
+        n += batch_values;
+      }
+    }
+  }
+};
+
+template <class ViewType, class RandomPool, class Distribution>
+void fill_random_distribution(ViewType a, RandomPool g, Distribution dist) {
+  using functor =
+      fill_random_distribution_functor<ViewType, RandomPool, Distribution>;
+  const int64_t span = a.span();
+  if (span > 0)
+    parallel_for("Kokkos::fill_random",
+                 Kokkos::RangePolicy<typename ViewType::execution_space>(
+                     0, (span + functor::chunk - 1) / functor::chunk),
+                 functor(a, g, dist));
+}
+
+template <class ViewType, class Bijection, class DeviceType,
+          class Distribution>
+void fill_random_distribution(
+    ViewType a, Random_CounterBased_Pool<Bijection, DeviceType> g,
+    Distribution dist) {
+  using functor = fill_random_counter_based_functor<ViewType, Bijection,
+                                                    DeviceType, Distribution>;
+  const int64_t span = a.span();
+  if (span > 0)
+    parallel_for("Kokkos::fill_random",
+                 Kokkos::RangePolicy<typename ViewType::execution_space>(
+                     0, (span + functor::chunk - 1) / functor::chunk),
+                 functor(a, g, dist));
+}
+
+template <class ViewType>
+void fill_random_require_contiguous(const ViewType& a) {
+  if (!a.span_is_contiguous()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::fill_random_normal / fill_random_exponential require a View "
+        "with a contiguous span");
+  }
+}
+
+template <class Scalar>
+struct fill_random_has_bulk
+    : std::integral_constant<bool, std::is_same<Scalar, float>::value ||
+                                       std::is_same<Scalar, double>::value> {};
+
+template <class ViewType, class Bijection, class DeviceType>
+bool fill_random_bulk_uniform(
+    ViewType a, Random_CounterBased_Pool<Bijection, DeviceType> g,
+    typename ViewType::const_value_type begin,
+    typename ViewType::const_value_type end, std::true_type) {
+  if (!a.span_is_contiguous()) return false;
+  using Scalar = typename ViewType::non_const_value_type;
+  fill_random_distribution(
+      a, g, random_uniform_distribution<Scalar>{begin, Scalar(end - begin)});
+  return true;
+}
+
+template <class ViewType, class Bijection, class DeviceType>
+bool fill_random_bulk_uniform(
+    ViewType, Random_CounterBased_Pool<Bijection, DeviceType>,
+    typename ViewType::const_value_type, typename ViewType::const_value_type,
+    std::false_type) {
+  return false;
+}
+
+/// Counter-based pools fill contiguous float and double Views in bulk:
+/// blocks of uniform values are generated lane-parallel, without any
+/// per-thread state, from a block of streams reserved for the fill.
+template <class ViewType, class Bijection, class DeviceType>
+bool fill_random_bulk_uniform(
+    ViewType a, Random_CounterBased_Pool<Bijection, DeviceType> g,
+    typename ViewType::const_value_type begin,
+    typename ViewType::const_value_type end) {
+  return fill_random_bulk_uniform(
+      a, g, begin, end,
+      fill_random_has_bulk<typename ViewType::non_const_value_type>());
+}
+
+template <class ViewType, class RandomPool>
+bool fill_random_bulk_uniform(ViewType, RandomPool,
+                              typename ViewType::const_value_type,
+                              typename ViewType::const_value_type) {
+  return false;
+}
+
+}  // namespace Impl
+
+template <class ViewType, class RandomPool, class IndexType = int64_t>
+void fill_random(ViewType a, RandomPool g,
+                 typename ViewType::const_value_type range) {
+  if (!Impl::fill_random_bulk_uniform(
+          a, g, typename ViewType::non_const_value_type(0), range))
+    Impl::fill_random_generic<IndexType>(a, g, range);
+}
+
+template <class ViewType, class RandomPool, class IndexType = int64_t>
+void fill_random(ViewType a, RandomPool g,
+                 typename ViewType::const_value_type begin,
+                 typename ViewType::const_value_type end) {
+  if (!Impl::fill_random_bulk_uniform(a, g, begin, end))
+    Impl::fill_random_generic<IndexType>(a, g, begin, end);
+}
+
+/// Fill a contiguous float or double View with normal values (Box-Muller).
+template <class ViewType, class RandomPool>
+void fill_random_normal(ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean = 0,
+                        typename ViewType::const_value_type std_dev = 1) {
+  Impl::fill_random_require_contiguous(a);
+  Impl::fill_random_distribution(
+      a, g,
+      Impl::random_normal_distribution<typename ViewType::non_const_value_type>{
+          mean, std_dev});
+}
+
+/// Fill a contiguous float or double View with exponential values.
+template <class ViewType, class RandomPool>
+void fill_random_exponential(ViewType a, RandomPool g,
+                             typename ViewType::const_value_type rate = 1) {
+  Impl::fill_random_require_contiguous(a);
+  Impl::fill_random_distribution(
+      a, g,
+      Impl::random_exponential_distribution<
+          typename ViewType::non_const_value_type>{rate});
+}
 }  // namespace Kokkos
 
 #endif
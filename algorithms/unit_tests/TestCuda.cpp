@@ -83,6 +83,18 @@ CUDA_RANDOM_XORSHIFT64(132141141)
 CUDA_RANDOM_XORSHIFT1024(52428813)
 CUDA_SORT_UNSIGNED(171)
 
+TEST(cuda, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::Cuda>(52428813);
+}
+
+TEST(cuda, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::Cuda>(52428813);
+}
+
+TEST(cuda, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::Cuda>();
+}
+
 #undef CUDA_RANDOM_XORSHIFT64
 #undef CUDA_RANDOM_XORSHIFT1024
 #undef CUDA_SORT_UNSIGNED
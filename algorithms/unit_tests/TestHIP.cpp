@@ -74,6 +74,16 @@ void hip_test_random_xorshift1024(size_t num_draws) {
 
 TEST(hip, Random_XorShift64) { hip_test_random_xorshift64(132141141); }
 TEST(hip, Random_XorShift1024_0) { hip_test_random_xorshift1024(52428813); }
+TEST(hip, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::Experimental::HIP>(52428813);
+}
+TEST(hip, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::Experimental::HIP>(52428813);
+}
+
+TEST(hip, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::Experimental::HIP>();
+}
 TEST(hip, SortUnsigned) {
   Impl::test_sort<Kokkos::Experimental::HIP, unsigned>(171);
 }
@@ -76,6 +76,18 @@ namespace Test {
 
 HPX_RANDOM_XORSHIFT64(10240000)
 HPX_RANDOM_XORSHIFT1024(10130144)
+
+TEST(hpx, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::Experimental::HPX>(10240000);
+}
+
+TEST(hpx, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::Experimental::HPX>(10240000);
+}
+
+TEST(hpx, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::Experimental::HPX>();
+}
 HPX_SORT_UNSIGNED(171)
 
 #undef HPX_RANDOM_XORSHIFT64
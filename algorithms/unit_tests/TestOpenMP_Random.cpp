@@ -69,6 +69,18 @@ namespace Test {
 OPENMP_RANDOM_XORSHIFT64(10240000)
 OPENMP_RANDOM_XORSHIFT1024(10130144)
 
+TEST(openmp, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::OpenMP>(10240000);
+}
+
+TEST(openmp, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::OpenMP>(10240000);
+}
+
+TEST(openmp, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::OpenMP>();
+}
+
 #undef OPENMP_RANDOM_XORSHIFT64
 #undef OPENMP_RANDOM_XORSHIFT1024
 }  // namespace Test
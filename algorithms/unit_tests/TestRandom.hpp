@@ -489,6 +489,190 @@ void test_random(unsigned int num_draws) {
   ASSERT_EQ(test_double.pass_hist3d_var, 1);
   ASSERT_EQ(test_double.pass_hist3d_covar, 1);
 }
+
+template <class Pool>
+struct test_counter_based_fill {
+  using execution_space = typename Pool::device_type::execution_space;
+  using view_type = Kokkos::View<uint64_t**, typename Pool::device_type>;
+
+  Pool pool;
+  view_type draws;
+
+  test_counter_based_fill(Pool pool_, view_type draws_)
+      : pool(pool_), draws(draws_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    typename Pool::generator_type gen = pool.get_state(i);
+    for (int j = 0; j < static_cast<int>(draws.extent(1)); ++j)
+      draws(i, j) = gen.urand64();
+    pool.free_state(gen);
+  }
+};
+
+// Known-answer test for the first block of (seed 0, stream 0), and
+// bitwise reproducibility of per-index streams drawn in parallel.
+template <class Pool>
+void test_random_counter_based(const uint32_t (&expected)[4]) {
+  using host_generator =
+      typename Pool::generator_type;  // stateless: usable on the host
+
+  host_generator kat(0, 0);
+  for (int i = 0; i < 4; ++i) ASSERT_EQ(expected[i], kat.urand());
+
+  // advance() is equivalent to drawing the skipped blocks
+  host_generator skipped(42, 7), drawn(42, 7);
+  skipped.advance(3);
+  for (int i = 0; i < 12; ++i) drawn.urand();
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(drawn.urand(), skipped.urand());
+
+  const uint64_t seed = 1318319;
+  Pool pool(seed);
+  typename test_counter_based_fill<Pool>::view_type draws("draws", 1000, 5);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<
+          typename test_counter_based_fill<Pool>::execution_space>(0, 1000),
+      test_counter_based_fill<Pool>(pool, draws));
+  auto h_draws = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), draws);
+
+  for (int i = 0; i < 1000; ++i) {
+    host_generator gen(seed, i);
+    for (int j = 0; j < 5; ++j) ASSERT_EQ(gen.urand64(), h_draws(i, j));
+  }
+
+  // Distinct streams differ
+  ASSERT_NE(h_draws(0, 0), h_draws(1, 0));
+}
+
+template <class DeviceType>
+void test_random_philox4x32(unsigned int num_draws) {
+  // Random123 kat_vectors: philox4x32 10, counter 0, key 0
+  const uint32_t expected[4] = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                0x9b00dbd8};
+  test_random_counter_based<Kokkos::Random_Philox4x32_Pool<DeviceType>>(
+      expected);
+  test_random<Kokkos::Random_Philox4x32_Pool<DeviceType>>(num_draws);
+}
+
+template <class DeviceType>
+void test_random_threefry4x32(unsigned int num_draws) {
+  // Random123 kat_vectors: threefry4x32 20, counter 0, key 0
+  const uint32_t expected[4] = {0x9c6ca96a, 0xe17eae66, 0xfc10ecd4,
+                                0x5256a7d8};
+  test_random_counter_based<Kokkos::Random_Threefry4x32_Pool<DeviceType>>(
+      expected);
+  test_random<Kokkos::Random_Threefry4x32_Pool<DeviceType>>(num_draws);
+}
+
+template <class Pool>
+struct test_draw_distribution {
+  using execution_space = typename Pool::device_type::execution_space;
+  using view_type       = Kokkos::View<double*, typename Pool::device_type>;
+  using rnd_type        = typename Pool::generator_type;
+  using ziggurat_type =
+      Kokkos::Random_Normal_Ziggurat<typename Pool::device_type>;
+
+  Pool pool;
+  ziggurat_type ziggurat;
+  view_type normal, ziggurat_normal, poisson_small, poisson_large;
+
+  test_draw_distribution(Pool pool_, int n)
+      : pool(pool_),
+        normal("normal", n),
+        ziggurat_normal("ziggurat", n),
+        poisson_small("poisson_small", n),
+        poisson_large("poisson_large", n) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    rnd_type gen = pool.get_state();
+    normal(i)    = Kokkos::rand_normal<rnd_type, double>::draw(gen, 1.0, 2.0);
+    ziggurat_normal(i) = ziggurat.draw(gen, -1.0, 0.5);
+    poisson_small(i)   = Kokkos::rand_poisson<rnd_type, int>::draw(gen, 3.5);
+    poisson_large(i) = Kokkos::rand_poisson<rnd_type, long>::draw(gen, 250.0);
+    pool.free_state(gen);
+  }
+};
+
+template <class ViewType>
+void check_moments(const ViewType& v, const double mean, const double var,
+                   const char* what) {
+  auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  const size_t n = h.span();
+  double sum = 0.0, sum2 = 0.0;
+  for (size_t i = 0; i < n; ++i) sum += h.data()[i];
+  const double m = sum / n;
+  for (size_t i = 0; i < n; ++i)
+    sum2 += (h.data()[i] - m) * (h.data()[i] - m);
+  const double s2 = sum2 / (n - 1);
+  // five standard errors of the mean, 5% on the variance
+  EXPECT_NEAR(mean, m, 5.0 * std::sqrt(var / n)) << what;
+  EXPECT_NEAR(var, s2, 0.05 * var) << what;
+}
+
+template <class Pool>
+void test_random_distributions_with_pool() {
+  const int n = 200000;
+  Pool pool(5374857);
+
+  Kokkos::View<double*, typename Pool::device_type> d("d", n);
+  Kokkos::View<float**, typename Pool::device_type> f("f", n / 100, 100);
+
+  Kokkos::fill_random_normal(d, pool, 2.0, 3.0);
+  check_moments(d, 2.0, 9.0, "fill_random_normal<double>");
+  Kokkos::fill_random_normal(f, pool);
+  check_moments(f, 0.0, 1.0, "fill_random_normal<float>");
+
+  Kokkos::fill_random_exponential(d, pool, 4.0);
+  check_moments(d, 0.25, 1.0 / 16.0, "fill_random_exponential<double>");
+  Kokkos::fill_random_exponential(f, pool, 0.5);
+  check_moments(f, 2.0, 4.0, "fill_random_exponential<float>");
+
+  Kokkos::fill_random(d, pool, -1.0, 3.0);
+  check_moments(d, 1.0, 16.0 / 12.0, "fill_random<double>");
+  Kokkos::fill_random(f, pool, 2.0f);
+  check_moments(f, 1.0, 4.0 / 12.0, "fill_random<float>");
+  {
+    auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_GE(h(i), -1.0);
+      ASSERT_LT(h(i), 3.0);
+    }
+  }
+
+  test_draw_distribution<Pool> draws(pool, n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename test_draw_distribution<Pool>::execution_space>(
+          0, n),
+      draws);
+  check_moments(draws.normal, 1.0, 4.0, "rand_normal");
+  check_moments(draws.ziggurat_normal, -1.0, 0.25, "Random_Normal_Ziggurat");
+  check_moments(draws.poisson_small, 3.5, 3.5, "rand_poisson(3.5)");
+  check_moments(draws.poisson_large, 250.0, 250.0, "rand_poisson(250)");
+}
+
+template <class DeviceType>
+void test_random_distributions() {
+  // bulk lane-parallel path
+  test_random_distributions_with_pool<
+      Kokkos::Random_Philox4x32_Pool<DeviceType>>();
+  // per-thread generator path
+  test_random_distributions_with_pool<
+      Kokkos::Random_XorShift64_Pool<DeviceType>>();
+
+  // Consecutive bulk fills from one counter-based pool draw from different
+  // streams and so produce different data
+  using pool_type = Kokkos::Random_Threefry4x32_Pool<DeviceType>;
+  pool_type pool(77);
+  Kokkos::View<double*, DeviceType> a("a", 100003), b("b", 100003);
+  Kokkos::fill_random_normal(a, pool);
+  Kokkos::fill_random_normal(b, pool);
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto h_b = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  size_t equal = 0;
+  for (size_t i = 0; i < h_a.extent(0); ++i) equal += h_a(i) == h_b(i);
+  ASSERT_LT(equal, size_t(10));
+}
 }  // namespace Impl
 
 }  // namespace Test
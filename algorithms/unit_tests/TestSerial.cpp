@@ -76,6 +76,18 @@ namespace Test {
 
 SERIAL_RANDOM_XORSHIFT64(10240000)
 SERIAL_RANDOM_XORSHIFT1024(10130144)
+
+TEST(serial, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::Serial>(10240000);
+}
+
+TEST(serial, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::Serial>(10240000);
+}
+
+TEST(serial, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::Serial>();
+}
 SERIAL_SORT_UNSIGNED(171)
 
 #undef SERIAL_RANDOM_XORSHIFT64
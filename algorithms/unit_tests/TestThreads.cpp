@@ -76,6 +76,18 @@ namespace Test {
 
 THREADS_RANDOM_XORSHIFT64(10240000)
 THREADS_RANDOM_XORSHIFT1024(10130144)
+
+TEST(threads, Random_Philox4x32) {
+  Impl::test_random_philox4x32<Kokkos::Threads>(10240000);
+}
+
+TEST(threads, Random_Threefry4x32) {
+  Impl::test_random_threefry4x32<Kokkos::Threads>(10240000);
+}
+
+TEST(threads, Random_Distributions) {
+  Impl::test_random_distributions<Kokkos::Threads>();
+}
 THREADS_SORT_UNSIGNED(171)
 
 #undef THREADS_RANDOM_XORSHIFT64
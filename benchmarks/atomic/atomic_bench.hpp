@@ -0,0 +1,306 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_BENCHMARKS_ATOMIC_BENCH_HPP
+#define KOKKOS_BENCHMARKS_ATOMIC_BENCH_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace AtomicBench {
+
+//----------------------------------------------------------------------------
+// Data types
+
+// 32 byte user type, which takes the generic lock based atomic path.
+struct Custom {
+  double val[4];
+
+  KOKKOS_INLINE_FUNCTION Custom() : Custom(0.0) {}
+  KOKKOS_INLINE_FUNCTION Custom(double v) {
+    for (int i = 0; i < 4; ++i) val[i] = v;
+  }
+  KOKKOS_INLINE_FUNCTION Custom(const Custom& src) {
+    for (int i = 0; i < 4; ++i) val[i] = src.val[i];
+  }
+  KOKKOS_INLINE_FUNCTION Custom(const volatile Custom& src) {
+    for (int i = 0; i < 4; ++i) val[i] = src.val[i];
+  }
+  KOKKOS_INLINE_FUNCTION Custom& operator=(const Custom& src) {
+    for (int i = 0; i < 4; ++i) val[i] = src.val[i];
+    return *this;
+  }
+  KOKKOS_INLINE_FUNCTION void operator=(const Custom& src) volatile {
+    for (int i = 0; i < 4; ++i) val[i] = src.val[i];
+  }
+  KOKKOS_INLINE_FUNCTION Custom operator+(const Custom& src) const {
+    Custom tmp;
+    for (int i = 0; i < 4; ++i) tmp.val[i] = val[i] + src.val[i];
+    return tmp;
+  }
+  KOKKOS_INLINE_FUNCTION bool operator<(const Custom& src) const {
+    return val[0] < src.val[0];
+  }
+  KOKKOS_INLINE_FUNCTION bool operator==(const Custom& src) const {
+    return val[0] == src.val[0] && val[1] == src.val[1] &&
+           val[2] == src.val[2] && val[3] == src.val[3];
+  }
+  KOKKOS_INLINE_FUNCTION bool operator!=(const Custom& src) const {
+    return !(*this == src);
+  }
+};
+
+template <class T>
+struct TypeName;
+
+#define ATOMIC_BENCH_TYPE_NAME(T, NAME)          \
+  template <>                                    \
+  struct TypeName<T> {                           \
+    static const char* name() { return NAME; } \
+  };
+
+ATOMIC_BENCH_TYPE_NAME(int32_t, "int32")
+ATOMIC_BENCH_TYPE_NAME(int64_t, "int64")
+ATOMIC_BENCH_TYPE_NAME(float, "float")
+ATOMIC_BENCH_TYPE_NAME(double, "double")
+ATOMIC_BENCH_TYPE_NAME(Kokkos::complex<double>, "complex")
+ATOMIC_BENCH_TYPE_NAME(Custom, "custom")
+
+#undef ATOMIC_BENCH_TYPE_NAME
+
+// Kokkos::complex has no ordering, so min is skipped for it.
+template <class T>
+struct HasMin : std::true_type {};
+template <>
+struct HasMin<Kokkos::complex<double>> : std::false_type {};
+
+//----------------------------------------------------------------------------
+// Operations
+
+// Every operation forwards the memory order to the explicit overloads, so
+// the memory order axis compares their cost against sequential consistency.
+struct OpAdd {
+  static const char* name() { return "add"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T&,
+                                           Order order) {
+    Kokkos::atomic_add(ptr, val, order);
+  }
+};
+
+struct OpFetchAdd {
+  static const char* name() { return "fetch_add"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T& seen,
+                                           Order order) {
+    seen = Kokkos::atomic_fetch_add(ptr, val, order);
+  }
+};
+
+struct OpMin {
+  static const char* name() { return "min"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T&,
+                                           Order order) {
+    Kokkos::atomic_fetch_min(ptr, val, order);
+  }
+};
+
+// A single compare-and-swap attempt against the last observed value.
+struct OpCAS {
+  static const char* name() { return "cas"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T& seen,
+                                           Order order) {
+    seen = Kokkos::atomic_compare_exchange(ptr, seen, val, order);
+  }
+};
+
+struct OpExchange {
+  static const char* name() { return "exchange"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T& seen,
+                                           Order order) {
+    seen = Kokkos::atomic_exchange(ptr, val, order);
+  }
+};
+
+struct OpLoad {
+  static const char* name() { return "load"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T&, T& seen,
+                                           Order order) {
+    seen = Kokkos::atomic_load(ptr, order);
+  }
+};
+
+struct OpStore {
+  static const char* name() { return "store"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T&,
+                                           Order order) {
+    Kokkos::atomic_store(ptr, val, order);
+  }
+};
+
+// Non-atomic update, as a reference point for uncontended atomics.
+struct OpPlainAdd {
+  static const char* name() { return "plain_add"; }
+  template <class T, class Order>
+  KOKKOS_INLINE_FUNCTION static void apply(T* ptr, const T& val, T&, Order) {
+    *ptr = *ptr + val;
+  }
+};
+
+template <class Order>
+struct OrderName;
+template <>
+struct OrderName<Kokkos::Impl::memory_order_relaxed_t> {
+  static const char* name() { return "relaxed"; }
+};
+template <>
+struct OrderName<Kokkos::Impl::memory_order_acquire_t> {
+  static const char* name() { return "acquire"; }
+};
+template <>
+struct OrderName<Kokkos::Impl::memory_order_release_t> {
+  static const char* name() { return "release"; }
+};
+template <>
+struct OrderName<Kokkos::Impl::memory_order_acq_rel_t> {
+  static const char* name() { return "acq_rel"; }
+};
+template <>
+struct OrderName<Kokkos::Impl::memory_order_seq_cst_t> {
+  static const char* name() { return "seq_cst"; }
+};
+
+//----------------------------------------------------------------------------
+// Contention
+
+enum Contention { Unique, Strided, Same };
+
+inline const char* contention_name(Contention c) {
+  return c == Unique ? "unique" : (c == Strided ? "strided" : "same");
+}
+
+//----------------------------------------------------------------------------
+
+template <class ExecSpace, class T, class Op, class Order>
+struct Kernel {
+  Kokkos::View<T*, ExecSpace> data;
+  Kokkos::View<T*, ExecSpace> sink;
+  int num_slots;
+  int slot_stride;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    const int idx = (i % num_slots) * slot_stride;
+    const T val   = T(1 + (i & 7));
+    T seen        = T(0);
+    Op::apply(&data(idx), val, seen, Order());
+    // Keep results of loads, exchanges and CAS observable.
+    if (seen == T(-1)) sink(0) = seen;
+  }
+};
+
+struct Result {
+  std::string backend;
+  int concurrency;
+  const char* type;
+  int size;
+  const char* operation;
+  const char* contention;
+  const char* memory_order;
+  int length;
+  int repeats;
+  int addresses;
+  double seconds;
+};
+
+template <class ExecSpace, class T, class Op, class Order>
+Result run(Contention contention, int length, int repeats, int slots) {
+  // Addresses of the strided pattern sit on separate cache lines.
+  const int line = sizeof(T) < 64 ? int(64 / sizeof(T)) : 1;
+  const int num_slots =
+      contention == Unique ? length : (contention == Strided ? slots : 1);
+  const int slot_stride = contention == Strided ? line : 1;
+
+  Kernel<ExecSpace, T, Op, Order> kernel;
+  kernel.data        = Kokkos::View<T*, ExecSpace>("data",
+                                            num_slots * slot_stride);
+  kernel.sink        = Kokkos::View<T*, ExecSpace>("sink", 1);
+  kernel.num_slots   = num_slots;
+  kernel.slot_stride = slot_stride;
+
+  const Kokkos::RangePolicy<ExecSpace> policy(0, length);
+  Kokkos::parallel_for("AtomicBench::warmup", policy, kernel);
+  ExecSpace().fence();
+
+  Kokkos::Timer timer;
+  for (int r = 0; r < repeats; ++r) {
+    Kokkos::parallel_for("AtomicBench::run", policy, kernel);
+  }
+  ExecSpace().fence();
+  const double seconds = timer.seconds();
+
+  return Result{ExecSpace::name(),
+                ExecSpace::concurrency(),
+                TypeName<T>::name(),
+                int(sizeof(T)),
+                Op::name(),
+                contention_name(contention),
+                OrderName<Order>::name(),
+                length,
+                repeats,
+                num_slots,
+                seconds};
+}
+
+}  // namespace AtomicBench
+
+#endif  // KOKKOS_BENCHMARKS_ATOMIC_BENCH_HPP
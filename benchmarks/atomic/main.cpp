@@ -1,120 +1,198 @@
 #include <Kokkos_Core.hpp>
-#include <impl/Kokkos_Timer.hpp>
-#include <Kokkos_Random.hpp>
-
-template <class Scalar>
-double test_atomic(int L, int N, int M, int K, int R,
-                   Kokkos::View<const int*> offsets) {
-  Kokkos::View<Scalar*> output("Output", N);
-  Kokkos::Impl::Timer timer;
-
-  for (int r = 0; r < R; r++)
-    Kokkos::parallel_for(
-        L, KOKKOS_LAMBDA(const int& i) {
-          Scalar s = 2;
-          for (int m = 0; m < M; m++) {
-            for (int k = 0; k < K; k++) s = s * s + s;
-            const int idx = (i + offsets(i, m)) % N;
-            Kokkos::atomic_add(&output(idx), s);
-          }
-        });
-  Kokkos::fence();
-  double time = timer.seconds();
-
-  return time;
+#include <atomic_bench.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace AtomicBench;
+
+struct Options {
+  int length  = 1 << 20;
+  int repeats = 10;
+  int slots   = 64;
+  std::vector<std::string> types;
+  std::vector<std::string> operations;
+  std::vector<std::string> contentions;
+  std::string output;
+};
+
+bool selected(const std::vector<std::string>& list, const char* name) {
+  if (list.empty()) return true;
+  for (const auto& entry : list)
+    if (entry == name) return true;
+  return false;
+}
+
+std::vector<std::string> split(const char* list) {
+  std::vector<std::string> entries;
+  std::string entry;
+  for (const char* c = list; *c; ++c) {
+    if (*c == ',') {
+      if (!entry.empty()) entries.push_back(entry);
+      entry.clear();
+    } else {
+      entry += *c;
+    }
+  }
+  if (!entry.empty()) entries.push_back(entry);
+  return entries;
+}
+
+template <class ExecSpace, class T, class Op, class Order>
+void run_contentions(const Options& opts, std::vector<Result>& results) {
+  const Contention contentions[] = {Unique, Strided, Same};
+  for (const Contention c : contentions) {
+    if (!selected(opts.contentions, contention_name(c))) continue;
+    // Non-atomic updates are only race free without contention.
+    if (std::is_same<Op, OpPlainAdd>::value && c != Unique) continue;
+    results.push_back(
+        run<ExecSpace, T, Op, Order>(c, opts.length, opts.repeats, opts.slots));
+  }
+}
+
+template <class ExecSpace, class T, class Op, class... Orders>
+void run_operation(const Options& opts, std::vector<Result>& results) {
+  if (!selected(opts.operations, Op::name())) return;
+  int expand[] = {
+      0, (run_contentions<ExecSpace, T, Op, Orders>(opts, results), 0)...};
+  (void)expand;
 }
 
-template <class Scalar>
-double test_no_atomic(int L, int N, int M, int K, int R,
-                      Kokkos::View<const int*> offsets) {
-  Kokkos::View<Scalar*> output("Output", N);
-  Kokkos::Impl::Timer timer;
-  for (int r = 0; r < R; r++)
-    Kokkos::parallel_for(
-        L, KOKKOS_LAMBDA(const int& i) {
-          Scalar s = 2;
-          for (int m = 0; m < M; m++) {
-            for (int k = 0; k < K; k++) s = s * s + s;
-            const int idx = (i + offsets(i, m)) % N;
-            output(idx) += s;
-          }
-        });
-  Kokkos::fence();
-  double time = timer.seconds();
-  return time;
+template <class ExecSpace, class T>
+void run_min(const Options& opts, std::vector<Result>& results,
+             std::true_type /* has min */) {
+  using namespace Kokkos::Impl;
+  run_operation<ExecSpace, T, OpMin, memory_order_relaxed_t,
+                memory_order_acq_rel_t, memory_order_seq_cst_t>(opts, results);
+}
+
+template <class ExecSpace, class T>
+void run_min(const Options&, std::vector<Result>&, std::false_type) {}
+
+template <class ExecSpace, class T>
+void run_type(const Options& opts, std::vector<Result>& results) {
+  using namespace Kokkos::Impl;
+  if (!selected(opts.types, TypeName<T>::name())) return;
+  run_operation<ExecSpace, T, OpPlainAdd, memory_order_relaxed_t>(opts,
+                                                                  results);
+  run_operation<ExecSpace, T, OpAdd, memory_order_relaxed_t,
+                memory_order_acq_rel_t, memory_order_seq_cst_t>(opts, results);
+  run_operation<ExecSpace, T, OpFetchAdd, memory_order_relaxed_t,
+                memory_order_acq_rel_t, memory_order_seq_cst_t>(opts, results);
+  run_min<ExecSpace, T>(opts, results, HasMin<T>());
+  run_operation<ExecSpace, T, OpCAS, memory_order_relaxed_t,
+                memory_order_acq_rel_t, memory_order_seq_cst_t>(opts, results);
+  run_operation<ExecSpace, T, OpExchange, memory_order_relaxed_t,
+                memory_order_acq_rel_t, memory_order_seq_cst_t>(opts, results);
+  run_operation<ExecSpace, T, OpLoad, memory_order_relaxed_t,
+                memory_order_acquire_t, memory_order_seq_cst_t>(opts, results);
+  run_operation<ExecSpace, T, OpStore, memory_order_relaxed_t,
+                memory_order_release_t, memory_order_seq_cst_t>(opts, results);
+}
+
+template <class ExecSpace>
+void run_backend(const Options& opts, std::vector<Result>& results) {
+  run_type<ExecSpace, int32_t>(opts, results);
+  run_type<ExecSpace, int64_t>(opts, results);
+  run_type<ExecSpace, float>(opts, results);
+  run_type<ExecSpace, double>(opts, results);
+  run_type<ExecSpace, Kokkos::complex<double> >(opts, results);
+  run_type<ExecSpace, Custom>(opts, results);
+}
+
+void write_json(FILE* out, const std::vector<Result>& results) {
+  fprintf(out, "{\n  \"benchmark\": \"atomic\",\n");
+  fprintf(out, "  \"kokkos_version\": %d,\n  \"results\": [\n", KOKKOS_VERSION);
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& r      = results[i];
+    const double updates = double(r.length) * r.repeats;
+    fprintf(out,
+            "    {\"backend\": \"%s\", \"concurrency\": %d, \"type\": \"%s\", "
+            "\"size\": %d, \"operation\": \"%s\", \"contention\": \"%s\", "
+            "\"memory_order\": \"%s\", \"length\": %d, \"repeats\": %d, "
+            "\"addresses\": %d, \"seconds\": %e, \"gupdates_per_s\": %e, "
+            "\"gbytes_per_s\": %e}%s\n",
+            r.backend.c_str(), r.concurrency, r.type, r.size, r.operation,
+            r.contention, r.memory_order, r.length, r.repeats, r.addresses,
+            r.seconds, 1.0e-9 * updates / r.seconds,
+            1.0e-9 * updates * 2 * r.size / r.seconds,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(out, "  ]\n}\n");
+}
+
+void print_help() {
+  printf("Options (lists are comma separated, default is everything):\n");
+  printf("  --length=L      Number of atomic updates per repeat [%d]\n",
+         1 << 20);
+  printf("  --repeats=R     Number of repeats [10]\n");
+  printf("  --slots=S       Addresses of the strided pattern [64]\n");
+  printf("  --types=...     int32,int64,float,double,complex,custom\n");
+  printf("  --ops=...       plain_add,add,fetch_add,min,cas,exchange,load,\n");
+  printf("                store\n");
+  printf("  --contention=.. unique,strided,same\n");
+  printf("  --output=FILE   Write JSON to FILE instead of stdout\n");
+  printf("Read-modify-write operations are swept over relaxed, acq_rel and\n");
+  printf("seq_cst; load and store over the memory orders they accept.\n");
 }
 
 int main(int argc, char* argv[]) {
   Kokkos::initialize(argc, argv);
   {
-    if (argc < 8) {
-      printf("Arguments: L N M D K R T\n");
-      printf("  L:   Number of iterations to run\n");
-      printf("  N:   Length of array to do atomics into\n");
-      printf("  M:   Number of atomics per iteration to do\n");
-      printf("  D:   Distance from index i to do atomics into (randomly)\n");
-      printf("  K:   Number of FMAD per atomic\n");
-      printf("  R:   Number of repeats of the experiments\n");
-      printf("  T:   Type of atomic\n");
-      printf("       1 - int\n");
-      printf("       2 - long\n");
-      printf("       3 - float\n");
-      printf("       4 - double\n");
-      printf("       5 - complex<double>\n");
-      printf("Example Input GPU:\n");
-      printf("  Histogram : 1000000 1000 1 1000 1 10 1\n");
-      printf("  MD Force : 100000 100000 100 1000 20 10 4\n");
-      printf("  Matrix Assembly : 100000 1000000 50 1000 20 10 4\n");
-      Kokkos::finalize();
-      return 0;
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+      const char* arg = argv[i];
+      const char* val = strchr(arg, '=');
+      val             = val ? val + 1 : "";
+      if (!strncmp(arg, "--length=", 9)) {
+        opts.length = std::stoi(val);
+      } else if (!strncmp(arg, "--repeats=", 10)) {
+        opts.repeats = std::stoi(val);
+      } else if (!strncmp(arg, "--slots=", 8)) {
+        opts.slots = std::stoi(val);
+      } else if (!strncmp(arg, "--types=", 8)) {
+        opts.types = split(val);
+      } else if (!strncmp(arg, "--ops=", 6)) {
+        opts.operations = split(val);
+      } else if (!strncmp(arg, "--contention=", 13)) {
+        opts.contentions = split(val);
+      } else if (!strncmp(arg, "--output=", 9)) {
+        opts.output = val;
+      } else if (!strcmp(arg, "--help") || !strcmp(arg, "-h")) {
+        print_help();
+        Kokkos::finalize();
+        return 0;
+      }
     }
 
-    int L    = std::stoi(argv[1]);
-    int N    = std::stoi(argv[2]);
-    int M    = std::stoi(argv[3]);
-    int D    = std::stoi(argv[4]);
-    int K    = std::stoi(argv[5]);
-    int R    = std::stoi(argv[6]);
-    int type = std::stoi(argv[7]);
-
-    Kokkos::View<int*> offsets("Offsets", L, M);
-    Kokkos::Random_XorShift64_Pool<> pool(12371);
-    Kokkos::fill_random(offsets, pool, D);
-    double time = 0;
-    if (type == 1) time = test_atomic<int>(L, N, M, K, R, offsets);
-    if (type == 2) time = test_atomic<long>(L, N, M, K, R, offsets);
-    if (type == 3) time = test_atomic<float>(L, N, M, K, R, offsets);
-    if (type == 4) time = test_atomic<double>(L, N, M, K, R, offsets);
-    if (type == 5)
-      time = test_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
-
-    double time2 = 1;
-    if (type == 1) time2 = test_no_atomic<int>(L, N, M, K, R, offsets);
-    if (type == 2) time2 = test_no_atomic<long>(L, N, M, K, R, offsets);
-    if (type == 3) time2 = test_no_atomic<float>(L, N, M, K, R, offsets);
-    if (type == 4) time2 = test_no_atomic<double>(L, N, M, K, R, offsets);
-    if (type == 5)
-      time2 = test_no_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
-
-    int size = 0;
-    if (type == 1) size = sizeof(int);
-    if (type == 2) size = sizeof(long);
-    if (type == 3) size = sizeof(float);
-    if (type == 4) size = sizeof(double);
-    if (type == 5) size = sizeof(Kokkos::complex<double>);
-
-    printf("%i\n", size);
-    printf(
-        "Time: %s %i %i %i %i %i %i (t_atomic: %e t_nonatomic: %e ratio: %lf "
-        ")( GUpdates/s: %lf GB/s: %lf )\n",
-        (type == 1)
-            ? "int"
-            : ((type == 2)
-                   ? "long"
-                   : ((type == 3) ? "float"
-                                  : ((type == 4) ? "double" : "complex"))),
-        L, N, M, D, K, R, time, time2, time / time2, 1.e-9 * L * R * M / time,
-        1.0 * L * R * M * 2 * size / time / 1024 / 1024 / 1024);
+    std::vector<Result> results;
+#if defined(KOKKOS_ENABLE_SERIAL)
+    run_backend<Kokkos::Serial>(opts, results);
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+    run_backend<Kokkos::OpenMP>(opts, results);
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+    run_backend<Kokkos::Threads>(opts, results);
+#endif
+#if defined(KOKKOS_ENABLE_HPX)
+    run_backend<Kokkos::Experimental::HPX>(opts, results);
+#endif
+    if (!Kokkos::SpaceAccessibility<
+            Kokkos::HostSpace,
+            Kokkos::DefaultExecutionSpace::memory_space>::accessible) {
+      run_backend<Kokkos::DefaultExecutionSpace>(opts, results);
+    }
+
+    FILE* out = opts.output.empty() ? stdout : fopen(opts.output.c_str(), "w");
+    if (!out) {
+      fprintf(stderr, "Cannot open %s\n", opts.output.c_str());
+    } else {
+      write_json(out, results);
+      if (out != stdout) fclose(out);
+    }
   }
   Kokkos::finalize();
 }
@@ -48,6 +48,7 @@ KOKKOS_ENABLE_OPTION(COMPILER_WARNINGS    OFF "Whether to print all compiler war
 KOKKOS_ENABLE_OPTION(PROFILING_LOAD_PRINT OFF "Whether to print information about which profiling tools got loaded")
 KOKKOS_ENABLE_OPTION(TUNING               OFF "Whether to create bindings for tuning tools")
 KOKKOS_ENABLE_OPTION(AGGRESSIVE_VECTORIZATION OFF "Whether to aggressively vectorize loops")
+KOKKOS_ENABLE_OPTION(OPENMP_SIMD          ON  "Whether to honor 'omp simd' directives in builds without the OpenMP backend")
 
 IF (KOKKOS_ENABLE_CUDA)
   SET(KOKKOS_COMPILER_CUDA_VERSION "${KOKKOS_COMPILER_VERSION_MAJOR}${KOKKOS_COMPILER_VERSION_MINOR}")
@@ -102,6 +103,22 @@ IF (KOKKOS_ENABLE_AGGRESSIVE_VECTORIZATION)
   SET(KOKKOS_OPT_RANGE_AGGRESSIVE_VECTORIZATION ON)
 ENDIF()
 
+# 'omp simd' only needs the compiler, not an OpenMP runtime.  Builds with the
+# OpenMP backend already understand it; elsewhere it is turned on with
+# -fopenmp-simd where the compiler supports that flag.
+IF (KOKKOS_ENABLE_OPENMP_SIMD)
+  IF (KOKKOS_ENABLE_OPENMP OR KOKKOS_ENABLE_CUDA OR KOKKOS_ENABLE_HIP OR
+      NOT KOKKOS_CXX_COMPILER_ID MATCHES "^(GNU|Clang|AppleClang|IntelClang|Intel)$")
+    UNSET(KOKKOS_ENABLE_OPENMP_SIMD)
+    LIST(REMOVE_ITEM KOKKOS_ENABLED_OPTIONS OPENMP_SIMD)
+  ELSE()
+    COMPILER_SPECIFIC_OPTIONS(
+      Intel      -qopenmp-simd
+      DEFAULT    -fopenmp-simd
+    )
+  ENDIF()
+ENDIF()
+
 # This is known to occur with Clang 9. We would need to use nvcc as the linker
 # http://lists.llvm.org/pipermail/cfe-dev/2018-June/058296.html
 # TODO: Through great effort we can use a different linker by hacking
@@ -174,12 +174,13 @@ void test_dynrankview_op_perf(const int par_size) {
   const size_type dim_2 = 90;
   const size_type dim_3 = 30;
 
-  double elapsed_time_view       = 0;
-  double elapsed_time_compview   = 0;
-  double elapsed_time_strideview = 0;
-  double elapsed_time_view_rank7 = 0;
-  double elapsed_time_drview     = 0;
-  double elapsed_time_compdrview = 0;
+  double elapsed_time_view         = 0;
+  double elapsed_time_compview     = 0;
+  double elapsed_time_strideview   = 0;
+  double elapsed_time_view_rank7   = 0;
+  double elapsed_time_drview       = 0;
+  double elapsed_time_compdrview   = 0;
+  double elapsed_time_staticdrview = 0;
   Kokkos::Timer timer;
   {
     Kokkos::View<double ***, DeviceType> testview("testview", par_size, dim_2,
@@ -248,6 +249,20 @@ void test_dynrankview_op_perf(const int par_size) {
     std::cout << " DynRankView sum computation time: "
               << elapsed_time_compdrview << std::endl;
   }
+  {
+    Kokkos::DynRankView<double, DeviceType> testdrview("testdrview", par_size,
+                                                       dim_2, dim_3);
+    using FunctorType = InitViewFunctor<DeviceType>;
+
+    timer.reset();
+    Kokkos::RangePolicy<DeviceType> policy(0, par_size);
+    auto testview = Kokkos::as_view_of_rank<3>(testdrview);
+    Kokkos::parallel_for(policy, FunctorType(testview));
+    DeviceType().fence();
+    elapsed_time_staticdrview = timer.seconds();
+    std::cout << " DynRankView as static rank View time (init only): "
+              << elapsed_time_staticdrview << std::endl;
+  }
 
   std::cout << " Ratio of View to DynRankView time: "
             << elapsed_time_view / elapsed_time_drview
@@ -255,6 +270,9 @@ void test_dynrankview_op_perf(const int par_size) {
   std::cout << " Ratio of View to DynRankView sum computation time: "
             << elapsed_time_compview / elapsed_time_compdrview
             << std::endl;  // expect < 1
+  std::cout << " Ratio of View to DynRankView as static rank View time: "
+            << elapsed_time_view / elapsed_time_staticdrview
+            << std::endl;  // expect ~ 1
   std::cout << " Ratio of View to View Rank7  time: "
             << elapsed_time_view / elapsed_time_view_rank7
             << std::endl;  // expect < 1
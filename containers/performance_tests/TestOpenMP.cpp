@@ -113,4 +113,22 @@ TEST(TEST_CATEGORY, scatter_view) {
   //  Kokkos::Experimental::ScatterAtomic>(10, 1000 * 1000);
 }
 
+TEST(TEST_CATEGORY, scatter_view_histogram) {
+  std::cout << "ScatterView histogram data-duplicated test:\n";
+  Perf::test_scatter_view_histogram<Kokkos::OpenMP,
+                                    Kokkos::Experimental::ScatterDuplicated,
+                                    Kokkos::Experimental::ScatterNonAtomic>(
+      10, 10 * 1000 * 1000, 100 * 1000, 8);
+  std::cout << "ScatterView histogram atomics test:\n";
+  Perf::test_scatter_view_histogram<Kokkos::OpenMP,
+                                    Kokkos::Experimental::ScatterNonDuplicated,
+                                    Kokkos::Experimental::ScatterAtomic>(
+      10, 10 * 1000 * 1000, 100 * 1000, 8);
+  std::cout << "ScatterView histogram hybrid test:\n";
+  Perf::test_scatter_view_histogram<Kokkos::OpenMP,
+                                    Kokkos::Experimental::ScatterHybrid,
+                                    Kokkos::Experimental::ScatterAtomic>(
+      10, 10 * 1000 * 1000, 100 * 1000, 8);
+}
+
 }  // namespace Performance
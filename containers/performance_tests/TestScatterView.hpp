@@ -112,6 +112,35 @@ void test_scatter_view(int m, int n) {
   }
 }
 
+// Histogram with a skewed distribution: 15 out of 16 updates go to one of
+// 'hot_bins' bins, the others are spread over all 'bins' bins.
+template <typename ExecSpace, typename Duplication, typename Contribution>
+void test_scatter_view_histogram(int m, int n, int bins, int hot_bins) {
+  Kokkos::View<double*, Kokkos::LayoutRight, ExecSpace> histogram("histogram",
+                                                                  bins);
+  auto scatter_view = Kokkos::Experimental::create_scatter_view<
+      Kokkos::Experimental::ScatterSum, Duplication, Contribution>(histogram);
+  auto policy = Kokkos::RangePolicy<ExecSpace, int>(0, n);
+  auto f      = KOKKOS_LAMBDA(int i) {
+    auto scatter_access = scatter_view.access();
+    const int bin =
+        i % 16 ? i % hot_bins : int((unsigned(i) * 2654435761u) % bins);
+    scatter_access(bin) += 1.0;
+  };
+  for (int foo = 0; foo < 3; ++foo) {
+    Kokkos::Timer timer;
+    timer.reset();
+    for (int k = 0; k < m; ++k) {
+      Kokkos::parallel_for(policy, f, "scatter_view_histogram_test");
+      Kokkos::Experimental::contribute(histogram, scatter_view);
+      scatter_view.reset_except(histogram);
+    }
+    Kokkos::fence();
+    auto t = timer.seconds();
+    std::cout << "histogram test took " << t << " seconds\n";
+  }
+}
+
 }  // namespace Perf
 
 #endif
@@ -130,6 +130,56 @@ class Bitset {
     return f.apply();
   }
 
+  /// index of the lowest bit set to 1, or size() if no bit is set
+  /// can only be called from the host
+  unsigned find_first_set() const {
+    Impl::BitsetFindFirstSet<Bitset<Device> > f(*this);
+    return f.apply();
+  }
+
+  /// write the indices of the bits set to 1, in increasing order, to the
+  /// front of the rank-1 view indices and return the number of bits set;
+  /// indices beyond the extent of the view are dropped
+  /// can only be called from the host
+  template <typename IndexView>
+  unsigned extract_set(IndexView const& indices) const {
+    Impl::BitsetExtractSet<Bitset<Device>, IndexView> f(*this, indices);
+    return f.apply();
+  }
+
+  /// this = this & other
+  /// can only be called from the host
+  void bitwise_and(ConstBitset<Device> const& other) {
+    Impl::BitsetBinaryOp<Bitset<Device>, ConstBitset<Device>, Impl::BitsetAnd>
+        f(*this, other);
+    f.apply();
+  }
+
+  /// this = this | other
+  /// can only be called from the host
+  void bitwise_or(ConstBitset<Device> const& other) {
+    Impl::BitsetBinaryOp<Bitset<Device>, ConstBitset<Device>, Impl::BitsetOr>
+        f(*this, other);
+    f.apply();
+  }
+
+  /// this = this ^ other
+  /// can only be called from the host
+  void bitwise_xor(ConstBitset<Device> const& other) {
+    Impl::BitsetBinaryOp<Bitset<Device>, ConstBitset<Device>, Impl::BitsetXor>
+        f(*this, other);
+    f.apply();
+  }
+
+  /// this = this & ~other
+  /// can only be called from the host
+  void bitwise_andnot(ConstBitset<Device> const& other) {
+    Impl::BitsetBinaryOp<Bitset<Device>, ConstBitset<Device>,
+                         Impl::BitsetAndNot>
+        f(*this, other);
+    f.apply();
+  }
+
   /// set all bits to 1
   /// can only be called from the host
   void set() {
@@ -295,6 +345,15 @@ class Bitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename Bitset>
+  friend struct Impl::BitsetFindFirstSet;
+
+  template <typename Bitset, typename IndexView>
+  friend struct Impl::BitsetExtractSet;
+
+  template <typename DstBitset, typename SrcBitset, typename Op>
+  friend struct Impl::BitsetBinaryOp;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
 
@@ -347,6 +406,17 @@ class ConstBitset {
     return f.apply();
   }
 
+  unsigned find_first_set() const {
+    Impl::BitsetFindFirstSet<ConstBitset<Device> > f(*this);
+    return f.apply();
+  }
+
+  template <typename IndexView>
+  unsigned extract_set(IndexView const& indices) const {
+    Impl::BitsetExtractSet<ConstBitset<Device>, IndexView> f(*this, indices);
+    return f.apply();
+  }
+
   KOKKOS_FORCEINLINE_FUNCTION
   bool test(unsigned i) const {
     if (i < m_size) {
@@ -368,6 +438,15 @@ class ConstBitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename Bitset>
+  friend struct Impl::BitsetFindFirstSet;
+
+  template <typename Bitset, typename IndexView>
+  friend struct Impl::BitsetExtractSet;
+
+  template <typename DstBitset, typename SrcBitset, typename Op>
+  friend struct Impl::BitsetBinaryOp;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst,
                         ConstBitset<SrcDevice> const& src);
@@ -185,6 +185,18 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   t_host h_view;
   //@}
 
+ protected:
+  // Optional dirty tracking along the leading dimension:
+  // dirty_blocks(b) != 0 -> rows [b, b + 1) * rows_per_block may differ
+  // between host and device.  rows_per_block == 0 with allocated
+  // dirty_blocks means the rows cannot be mapped (e.g. a subview), so any
+  // modification marks every block.
+  using t_dirty_blocks = View<unsigned char*, LayoutLeft, Kokkos::HostSpace>;
+  t_dirty_blocks dirty_blocks;
+  size_t rows_per_block = 0;
+
+ public:
+
   //! \name Constructors
   //@{
 
@@ -250,14 +262,18 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   DualView(const DualView<SS, LS, DS, MS>& src)
       : modified_flags(src.modified_flags),
         d_view(src.d_view),
-        h_view(src.h_view) {}
+        h_view(src.h_view),
+        dirty_blocks(src.dirty_blocks),
+        rows_per_block(src.rows_per_block) {}
 
   //! Subview constructor
   template <class SD, class S1, class S2, class S3, class Arg0, class... Args>
   DualView(const DualView<SD, S1, S2, S3>& src, const Arg0& arg0, Args... args)
       : modified_flags(src.modified_flags),
         d_view(Kokkos::subview(src.d_view, arg0, args...)),
-        h_view(Kokkos::subview(src.h_view, arg0, args...)) {}
+        h_view(Kokkos::subview(src.h_view, arg0, args...)),
+        dirty_blocks(src.dirty_blocks),
+        rows_per_block(0) {}
 
   /// \brief Create DualView from existing device and host View objects.
   ///
@@ -502,7 +518,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         }
 #endif
 
-        deep_copy(d_view, h_view);
+        impl_sync_copy(d_view, h_view);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_device_sync();
       }
@@ -519,7 +535,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         }
 #endif
 
-        deep_copy(h_view, d_view);
+        impl_sync_copy(h_view, d_view);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_host_sync();
       }
@@ -574,7 +590,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       }
 #endif
 
-      deep_copy(h_view, d_view);
+      impl_sync_copy(h_view, d_view);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_host_sync();
     }
@@ -597,7 +613,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       }
 #endif
 
-      deep_copy(d_view, h_view);
+      impl_sync_copy(d_view, h_view);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_device_sync();
     }
@@ -657,6 +673,17 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   /// data as modified.
   template <class Device>
   void modify() {
+    modify<Device>(0, d_view.extent(0));
+  }
+
+  /// \brief Mark rows [begin, end) of the leading dimension as modified
+  ///   on the given device \c Device.
+  ///
+  /// Without dirty tracking (see enable_dirty_tracking()) this is the
+  /// same as modify().  With it, the next sync only copies the blocks
+  /// of rows marked since the last sync.
+  template <class Device>
+  void modify(const size_t begin, const size_t end) {
     if (modified_flags.data() == nullptr) return;
     int dev = get_device_side<Device>();
 
@@ -676,6 +703,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           1;
       impl_report_host_modification();
     }
+    if (dev == 0 || dev == 1) impl_mark_dirty(begin, end);
 
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
     if (modified_flags(0) && modified_flags(1)) {
@@ -689,13 +717,18 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 #endif
   }
 
-  inline void modify_host() {
+  inline void modify_host() { modify_host(0, h_view.extent(0)); }
+
+  /// \brief Mark rows [begin, end) of the leading dimension as modified
+  ///   on the host.
+  inline void modify_host(const size_t begin, const size_t end) {
     if (modified_flags.data() != nullptr) {
       modified_flags(0) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
       impl_report_host_modification();
+      impl_mark_dirty(begin, end);
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
       if (modified_flags(0) && modified_flags(1)) {
         std::string msg = "Kokkos::DualView::modify_host ERROR: ";
@@ -709,13 +742,18 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     }
   }
 
-  inline void modify_device() {
+  inline void modify_device() { modify_device(0, d_view.extent(0)); }
+
+  /// \brief Mark rows [begin, end) of the leading dimension as modified
+  ///   on the device.
+  inline void modify_device(const size_t begin, const size_t end) {
     if (modified_flags.data() != nullptr) {
       modified_flags(1) =
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
       impl_report_device_modification();
+      impl_mark_dirty(begin, end);
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
       if (modified_flags(0) && modified_flags(1)) {
         std::string msg = "Kokkos::DualView::modify_device ERROR: ";
@@ -732,8 +770,127 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   inline void clear_sync_state() {
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    if (dirty_blocks.data() != nullptr) deep_copy(dirty_blocks, 0);
+  }
+
+  //@}
+  //! \name Methods for fine-grained dirty tracking.
+  //@{
+
+  /// \brief Track modifications in blocks of \c arg_rows_per_block rows
+  ///   of the leading dimension.
+  ///
+  /// Once enabled, sync only copies the blocks touched by the ranged
+  /// modify(begin, end), modify_host(begin, end) and
+  /// modify_device(begin, end) calls since the last sync; a plain
+  /// modify() still marks every block.  Ranged copies need rows to be
+  /// contiguous in memory (rank 1, or LayoutRight with a contiguous
+  /// span); other layouts keep copying the whole View.  Shallow copies
+  /// made afterwards share the tracking state, so enable it before
+  /// handing the DualView out.
+  void enable_dirty_tracking(const size_t arg_rows_per_block = 1) {
+    if (arg_rows_per_block == 0) {
+      Impl::throw_runtime_exception(
+          "DualView::enable_dirty_tracking requires a non-zero block size");
+    }
+    rows_per_block = arg_rows_per_block;
+    dirty_blocks   = t_dirty_blocks(
+        "DualView::dirty_blocks",
+        (d_view.extent(0) + rows_per_block - 1) / rows_per_block);
+    // Pending modifications predate the tracker: everything is dirty.
+    if (need_sync_host() || need_sync_device()) deep_copy(dirty_blocks, 1);
+  }
+
+  void disable_dirty_tracking() {
+    dirty_blocks   = t_dirty_blocks();
+    rows_per_block = 0;
+  }
+
+  bool dirty_tracking_enabled() const {
+    return dirty_blocks.data() != nullptr && rows_per_block != 0;
+  }
+
+ private:
+  void impl_mark_dirty(const size_t begin, const size_t end) {
+    if (dirty_blocks.data() == nullptr) return;
+    if (rows_per_block == 0) {
+      deep_copy(dirty_blocks, 1);
+      return;
+    }
+    const size_t last = end < d_view.extent(0) ? end : d_view.extent(0);
+    for (size_t b = begin / rows_per_block; b * rows_per_block < last; ++b) {
+      dirty_blocks(b) = 1;
+    }
   }
 
+  bool impl_rows_are_contiguous() const {
+    return (int(traits::rank) == 1 ||
+            (int(traits::rank) > 1 &&
+             std::is_same<typename traits::array_layout,
+                          Kokkos::LayoutRight>::value)) &&
+           d_view.span_is_contiguous() && h_view.span_is_contiguous();
+  }
+
+  /// Copy src into dst, restricted to the dirty blocks when tracking is
+  /// enabled, and clear the dirty blocks.  Each contiguous run of dirty
+  /// rows is reported to the tools as a deep copy of the bytes moved.
+  template <class DstView, class SrcView>
+  void impl_sync_copy(const DstView& dst, const SrcView& src) {
+    if (!dirty_tracking_enabled() || !impl_rows_are_contiguous()) {
+      deep_copy(dst, src);
+      if (dirty_blocks.data() != nullptr) deep_copy(dirty_blocks, 0);
+      return;
+    }
+
+    using copy_value_type = typename traits::non_const_value_type;
+    using raw_deep_copy =
+        Kokkos::Impl::DeepCopy<typename DstView::memory_space,
+                               typename SrcView::memory_space>;
+
+    const size_t nrows      = d_view.extent(0);
+    const size_t row_length = int(traits::rank) == 1 ? 1 : d_view.stride_0();
+    const size_t nblocks    = dirty_blocks.extent(0);
+
+    if (dst.data() != src.data()) Kokkos::fence();
+    for (size_t b = 0; b < nblocks;) {
+      if (!dirty_blocks(b)) {
+        ++b;
+        continue;
+      }
+      const size_t first = b;
+      while (b < nblocks && dirty_blocks(b)) dirty_blocks(b++) = 0;
+      if (dst.data() == src.data()) continue;
+
+      const size_t row_begin = first * rows_per_block;
+      const size_t row_end =
+          b * rows_per_block < nrows ? b * rows_per_block : nrows;
+      copy_value_type* const dst_ptr = dst.data() + row_begin * row_length;
+      const copy_value_type* const src_ptr =
+          src.data() + row_begin * row_length;
+      const size_t bytes =
+          (row_end - row_begin) * row_length * sizeof(copy_value_type);
+
+      if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy !=
+          nullptr) {
+        Kokkos::Profiling::beginDeepCopy(
+            Kokkos::Profiling::make_space_handle(
+                DstView::memory_space::name()),
+            dst.label(), dst_ptr,
+            Kokkos::Profiling::make_space_handle(
+                SrcView::memory_space::name()),
+            src.label(), src_ptr, bytes);
+      }
+      raw_deep_copy(dst_ptr, src_ptr, bytes);
+      if (Kokkos::Tools::Experimental::get_callbacks().end_deep_copy !=
+          nullptr) {
+        Kokkos::Profiling::endDeepCopy();
+      }
+    }
+    if (dst.data() != src.data()) Kokkos::fence();
+  }
+
+ public:
+
   //@}
   //! \name Methods for reallocating or resizing the View objects.
   //@{
@@ -759,6 +916,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+
+    if (dirty_tracking_enabled()) enable_dirty_tracking(rows_per_block);
   }
 
   /// \brief Resize both views, copying old contents into new if necessary.
@@ -809,6 +968,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       /* Mark Host copy as modified */
       modified_flags(0) = modified_flags(0) + 1;
     }
+
+    if (dirty_tracking_enabled()) enable_dirty_tracking(rows_per_block);
   }
 
   //@}
@@ -557,6 +557,10 @@ class DynRankView : public ViewTraits<DataType, Properties...> {
   impl_map() const {
     return m_map;
   }
+  KOKKOS_INLINE_FUNCTION
+  const Kokkos::Impl::SharedAllocationTracker& impl_track() const {
+    return m_track;
+  }
 
   //----------------------------------------
 
@@ -2089,4 +2093,93 @@ inline void realloc(DynRankView<T, P...>& v,
 
 }  // namespace Kokkos
 
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+template <class T, unsigned Rank>
+struct DynRankViewStaticDataType {
+  using type = typename DynRankViewStaticDataType<T*, Rank - 1>::type;
+};
+
+template <class T>
+struct DynRankViewStaticDataType<T, 0> {
+  using type = T;
+};
+
+}  // namespace Impl
+
+/** \brief  The View of static rank Rank sharing the traits of a DynRankView.
+ */
+template <unsigned Rank, class DRV>
+struct DynRankViewStaticType;
+
+template <unsigned Rank, class T, class... P>
+struct DynRankViewStaticType<Rank, DynRankView<T, P...> > {
+  using type =
+      View<typename Impl::DynRankViewStaticDataType<T, Rank>::type, P...>;
+};
+
+/** \brief  View of static rank Rank aliasing (and reference counting) the
+ *          data of a DynRankView whose runtime rank is Rank.
+ *
+ *  Throws if the runtime rank differs, or if the DynRankView is padded in a
+ *  way its layout cannot express at the static rank.
+ */
+template <unsigned Rank, class T, class... P>
+typename DynRankViewStaticType<Rank, DynRankView<T, P...> >::type
+as_view_of_rank(const DynRankView<T, P...>& v) {
+  using view_type =
+      typename DynRankViewStaticType<Rank, DynRankView<T, P...> >::type;
+
+  static_assert(Rank <= 7, "DynRankView rank is at most 7");
+
+  if (v.rank() != Rank) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::as_view_of_rank: rank of DynRankView '" + v.label() +
+        "' is " + std::to_string(v.rank()) + ", not " + std::to_string(Rank));
+  }
+
+  const view_type wrapped(v.data(), v.layout());
+  size_t wrapped_strides[8], strides[8];
+  wrapped.stride(wrapped_strides);
+  v.stride(strides);
+  for (unsigned r = 0; r < Rank; ++r) {
+    if (wrapped_strides[r] != strides[r]) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::as_view_of_rank: strides of DynRankView '" + v.label() +
+          "' are not representable at static rank");
+    }
+  }
+  return view_type(v.impl_track(), wrapped.impl_map());
+}
+
+/** \brief  Call f with the View of static rank matching the runtime rank of
+ *          v, so that kernels inside f are compiled once per rank without
+ *          per-access rank handling.
+ *
+ *  \code
+ *  Kokkos::dispatch_static_rank(drv, [&](auto const& view) {
+ *    using view_type = std::decay_t<decltype(view)>;
+ *    // kernels templated on view_type
+ *  });
+ *  \endcode
+ */
+template <class T, class... P, class Functor>
+void dispatch_static_rank(const DynRankView<T, P...>& v, Functor&& f) {
+  switch (v.rank()) {
+    case 0: f(as_view_of_rank<0>(v)); break;
+    case 1: f(as_view_of_rank<1>(v)); break;
+    case 2: f(as_view_of_rank<2>(v)); break;
+    case 3: f(as_view_of_rank<3>(v)); break;
+    case 4: f(as_view_of_rank<4>(v)); break;
+    case 5: f(as_view_of_rank<5>(v)); break;
+    case 6: f(as_view_of_rank<6>(v)); break;
+    default: f(as_view_of_rank<7>(v)); break;
+  }
+}
+
+}  // namespace Kokkos
+
 #endif
@@ -79,7 +79,9 @@ struct ChunkArraySpace<Kokkos::Experimental::HIPSpace> {
 }  // end namespace Impl
 
 /** \brief Dynamic views are restricted to rank-one and no layout.
- *         Resize only occurs on host outside of parallel_regions.
+ *         Resize only occurs on host outside of parallel_regions,
+ *         unless chunks are allocated from a MemoryPool in which case
+ *         the view may also grow from within a parallel region.
  *         Subviews are not allowed.
  */
 template <typename DataType, typename... P>
@@ -93,6 +95,10 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
   using track_type = Kokkos::Impl::SharedAllocationTracker;
 
+ public:
+  using memory_pool = Kokkos::MemoryPool<typename traits::device_type>;
+
+ private:
   static_assert(traits::rank == 1 && traits::rank_dynamic == 1,
                 "DynamicView must be rank-one");
 
@@ -125,6 +131,15 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
   unsigned m_chunk_max;  // number of entries in the chunk array - each pointing
                          // to a chunk of extent == m_chunk_size entries
   unsigned m_chunk_size;  // 2 << (m_chunk_shift - 1)
+  memory_pool m_pool;     // optional source of chunk allocations
+
+  KOKKOS_INLINE_FUNCTION
+  bool has_pool() const noexcept { return m_pool.capacity() != 0; }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_bytes() const noexcept {
+    return sizeof(typename traits::value_type) << m_chunk_shift;
+  }
 
  public:
   //----------------------------------------------------------------------
@@ -274,6 +289,87 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     return (*ch)[i0 & m_chunk_mask];
   }
 
+  //----------------------------------------
+  /** \brief  Chunk-local access for traversals that iterate over
+   *          whole chunks rather than individual entries.
+   *
+   *  Each chunk is contiguous storage of chunk_size() entries so a loop
+   *  over [0, chunk_extent(ic)) of chunk_data(ic) avoids the per-entry
+   *  chunk lookup of operator() and is amenable to vectorization.
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_count() const noexcept {
+    return (size() + m_chunk_mask) >> m_chunk_shift;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  pointer_type chunk_data(const size_t ic) const {
+    DynamicView::template verify_space<
+        Kokkos::Impl::ActiveExecutionMemorySpace>::check();
+#if defined(KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK)
+    if (chunk_count() <= ic) {
+      Kokkos::abort("Kokkos::DynamicView chunk bounds error");
+    }
+#endif
+    return m_chunks[ic];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t chunk_extent(const size_t ic) const noexcept {
+    const size_t begin = ic << m_chunk_shift;
+    const size_t n     = size();
+    return n <= begin ? 0
+                      : (n - begin < m_chunk_size ? n - begin : m_chunk_size);
+  }
+
+  //----------------------------------------
+  /** \brief  Grow the array to at least 'n' entries from within a
+   *          parallel region.
+   *
+   *  Requires the view to have been constructed with a MemoryPool.
+   *  Concurrent callers claim chunk slots with an atomic update of the
+   *  allocated chunk counter and fill the claimed slots from the pool;
+   *  concurrent readers of a claimed but not yet filled chunk wait in
+   *  operator() until the allocation completes.
+   *  The array never shrinks through this call.
+   */
+  template <typename IntType>
+  KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<std::is_integral<IntType>::value>::type
+      grow(IntType const& n) const {
+    if (!has_pool()) {
+      Kokkos::abort("Kokkos::DynamicView::grow requires a MemoryPool");
+    }
+
+    const uintptr_t NC = (uintptr_t(n) + m_chunk_mask) >> m_chunk_shift;
+
+    if (m_chunk_max < NC) {
+      Kokkos::abort("Kokkos::DynamicView::grow exceeded maximum size");
+    }
+
+    uintptr_t volatile* const pc =
+        reinterpret_cast<uintptr_t volatile*>(m_chunks + m_chunk_max);
+
+    for (uintptr_t ic = *pc; ic < NC;) {
+      const uintptr_t claimed = Kokkos::atomic_compare_exchange(pc, ic, ic + 1);
+      if (claimed == ic) {
+        void* const p = m_pool.allocate(chunk_bytes());
+        if (nullptr == p) {
+          Kokkos::abort("Kokkos::DynamicView::grow MemoryPool exhausted");
+        }
+        Kokkos::memory_fence();
+        *(reinterpret_cast<pointer_type volatile*>(m_chunks) + ic) =
+            reinterpret_cast<pointer_type>(p);
+        Kokkos::memory_fence();
+        ++ic;
+      } else {
+        ic = claimed;
+      }
+    }
+
+    Kokkos::atomic_fetch_max(pc + 1, uintptr_t(n));
+  }
+
   //----------------------------------------
   /** \brief  Resizing in serial can grow or shrink the array size
    *          up to the maximum number of chunks
@@ -289,6 +385,12 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     using local_value_type   = typename traits::value_type;
     using value_pointer_type = local_value_type*;
 
+    // Chunks of a pool-backed view must be allocated from the pool
+    if (has_pool()) {
+      resize_parallel(n);
+      return;
+    }
+
     const uintptr_t NC =
         (n + m_chunk_mask) >>
         m_chunk_shift;  // New total number of chunks needed for resize
@@ -321,6 +423,85 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     *(pc + 1) = n;
   }
 
+ private:
+  struct ChunkAllocate {
+    memory_pool m_pool;
+    pointer_type* m_chunks;
+    size_t m_bytes;
+    uintptr_t m_offset;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const uintptr_t i) const {
+      void* const p = m_pool.allocate(m_bytes);
+      if (nullptr == p) {
+        Kokkos::abort(
+            "Kokkos::DynamicView::resize_parallel MemoryPool exhausted");
+      }
+      m_chunks[m_offset + i] = reinterpret_cast<pointer_type>(p);
+    }
+  };
+
+  struct ChunkRelease {
+    memory_pool m_pool;
+    pointer_type* m_chunks;
+    size_t m_bytes;
+    uintptr_t m_offset;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const uintptr_t i) const {
+      if (nullptr != m_chunks[m_offset + i]) {
+        m_pool.deallocate(m_chunks[m_offset + i], m_bytes);
+        m_chunks[m_offset + i] = nullptr;
+      }
+    }
+  };
+
+ public:
+  /** \brief  Resizing in bulk can grow or shrink the array size
+   *          up to the maximum number of chunks.
+   *
+   *  When the view allocates chunks from a MemoryPool all added (or
+   *  removed) chunks are allocated (or released) by a single parallel
+   *  dispatch on the view's execution space.  Otherwise this is
+   *  equivalent to resize_serial.
+   */
+  template <typename IntType>
+  inline typename std::enable_if<
+      std::is_integral<IntType>::value &&
+      Kokkos::Impl::MemorySpaceAccess<
+          Kokkos::HostSpace,
+          typename Impl::ChunkArraySpace<
+              typename traits::memory_space>::memory_space>::accessible>::type
+  resize_parallel(IntType const& n) {
+    if (!has_pool()) {
+      resize_serial(n);
+      return;
+    }
+
+    using Range =
+        Kokkos::RangePolicy<typename traits::execution_space, uintptr_t>;
+
+    const uintptr_t NC = (n + m_chunk_mask) >> m_chunk_shift;
+
+    if (m_chunk_max < NC) {
+      Kokkos::abort("DynamicView::resize_parallel exceeded maximum size");
+    }
+
+    uintptr_t* const pc = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
+
+    if (*pc < NC) {
+      Kokkos::parallel_for(
+          "Kokkos::DynamicView::resize_parallel", Range(0, NC - *pc),
+          ChunkAllocate{m_pool, m_chunks, chunk_bytes(), *pc});
+    } else if (NC < *pc) {
+      Kokkos::parallel_for("Kokkos::DynamicView::resize_parallel",
+                           Range(0, *pc - NC),
+                           ChunkRelease{m_pool, m_chunks, chunk_bytes(), NC});
+    }
+    typename traits::execution_space().fence();
+
+    *pc       = NC;
+    *(pc + 1) = n;
+  }
+
   KOKKOS_INLINE_FUNCTION bool is_allocated() const {
     if (m_chunks == nullptr) {
       return false;
@@ -348,7 +529,8 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         m_chunk_shift(rhs.m_chunk_shift),
         m_chunk_mask(rhs.m_chunk_mask),
         m_chunk_max(rhs.m_chunk_max),
-        m_chunk_size(rhs.m_chunk_size) {
+        m_chunk_size(rhs.m_chunk_size),
+        m_pool(rhs.m_pool) {
     using SrcTraits = typename DynamicView<RT, RP...>::traits;
     using Mapping   = Kokkos::Impl::ViewMapping<traits, SrcTraits, void>;
     static_assert(Mapping::is_assignable,
@@ -364,11 +546,14 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     unsigned m_chunk_max;
     bool m_destroy;
     unsigned m_chunk_size;
+    memory_pool m_pool;
 
     // Initialize or destroy array of chunk pointers.
     // Two entries beyond the max chunks are allocation counters.
+    // Chunks allocated from a memory pool have already been released.
     inline void operator()(unsigned i) const {
-      if (m_destroy && i < m_chunk_max && nullptr != m_chunks[i]) {
+      if (m_destroy && i < m_chunk_max && nullptr != m_chunks[i] &&
+          m_pool.capacity() == 0) {
         typename traits::memory_space().deallocate(
             m_label.c_str(), m_chunks[i],
             sizeof(local_value_type) * m_chunk_size);
@@ -381,6 +566,17 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
       m_destroy = arg_destroy;
 
+      if (m_destroy && m_pool.capacity() != 0) {
+        // Return pool chunks from the execution space that can access them
+        Kokkos::parallel_for(
+            "Kokkos::DynamicView::destroy",
+            Kokkos::RangePolicy<typename traits::execution_space, uintptr_t>(
+                0, m_chunk_max),
+            ChunkRelease{m_pool, m_chunks,
+                         sizeof(local_value_type) * m_chunk_size, 0});
+        typename traits::execution_space().fence();
+      }
+
       Kokkos::Impl::ParallelFor<Destroy, Range> closure(
           *this,
           Range(0, m_chunk_max + 2));  // Add 2 to 'destroy' extra slots storing
@@ -404,12 +600,14 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     Destroy& operator=(const Destroy&) = default;
 
     Destroy(std::string label, typename traits::value_type** arg_chunk,
-            const unsigned arg_chunk_max, const unsigned arg_chunk_size)
+            const unsigned arg_chunk_max, const unsigned arg_chunk_size,
+            const memory_pool& arg_pool)
         : m_label(label),
           m_chunks(arg_chunk),
           m_chunk_max(arg_chunk_max),
           m_destroy(false),
-          m_chunk_size(arg_chunk_size) {}
+          m_chunk_size(arg_chunk_size),
+          m_pool(arg_pool) {}
   };
 
   /**\brief  Allocation constructor
@@ -417,10 +615,13 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
    *  Memory is allocated in chunks
    *  A maximum size is required in order to allocate a
    *  chunk-pointer array.
+   *  If a memory pool is given chunks are allocated from the pool,
+   *  which enables resize_parallel and in-kernel grow.
    */
   explicit inline DynamicView(const std::string& arg_label,
                               const unsigned min_chunk_size,
-                              const unsigned max_extent)
+                              const unsigned max_extent,
+                              const memory_pool& arg_pool = memory_pool())
       : m_track(),
         m_chunks(nullptr)
         // The chunk size is guaranteed to be a power of two
@@ -433,7 +634,14 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         m_chunk_max((max_extent + m_chunk_mask) >>
                     m_chunk_shift)  // max num pointers-to-chunks in array
         ,
-        m_chunk_size(2 << (m_chunk_shift - 1)) {
+        m_chunk_size(2 << (m_chunk_shift - 1)),
+        m_pool(arg_pool) {
+    if (has_pool() && m_pool.max_block_size() < chunk_bytes()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::DynamicView chunk size exceeds the MemoryPool maximum "
+          "block size");
+    }
+
     using chunk_array_memory_space = typename Impl::ChunkArraySpace<
         typename traits::memory_space>::memory_space;
     // A functor to deallocate all of the chunks upon final destruction
@@ -450,7 +658,8 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
     m_chunks = reinterpret_cast<pointer_type*>(record->data());
 
-    record->m_destroy = Destroy(arg_label, m_chunks, m_chunk_max, m_chunk_size);
+    record->m_destroy =
+        Destroy(arg_label, m_chunks, m_chunk_max, m_chunk_size, m_pool);
 
     // Initialize to zero
     record->m_destroy.construct_shared_allocation();
@@ -1883,6 +1883,75 @@ inline void deep_copy(
   Kokkos::deep_copy(dst, value.view());
 }
 
+template <class ExecSpace, class DT, class... DP>
+inline void deep_copy(
+    const ExecSpace& space, const Experimental::OffsetView<DT, DP...>& dst,
+    typename ViewTraits<DT, DP...>::const_value_type& value,
+    typename std::enable_if<
+        Kokkos::Impl::is_execution_space<ExecSpace>::value &&
+        std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                     void>::value>::type* = nullptr) {
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::non_const_value_type,
+                   typename ViewTraits<DT, DP...>::value_type>::value,
+      "deep_copy requires non-const type");
+
+  Kokkos::deep_copy(space, dst.view(), value);
+}
+
+/** \brief  Copy between OffsetViews as one bulk copy of the underlying
+ *          Views, ordered in the given execution space instance.  Begins
+ *          are not translated: matching OffsetViews copy element for
+ *          element.
+ */
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const ExecSpace& space, const Experimental::OffsetView<DT, DP...>& dst,
+    const Experimental::OffsetView<ST, SP...>& value,
+    typename std::enable_if<
+        Kokkos::Impl::is_execution_space<ExecSpace>::value &&
+        std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                     void>::value>::type* = nullptr) {
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::value_type,
+                   typename ViewTraits<ST, SP...>::non_const_value_type>::value,
+      "deep_copy requires matching non-const destination type");
+
+  Kokkos::deep_copy(space, dst.view(), value.view());
+}
+
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const ExecSpace& space, const Experimental::OffsetView<DT, DP...>& dst,
+    const View<ST, SP...>& value,
+    typename std::enable_if<
+        Kokkos::Impl::is_execution_space<ExecSpace>::value &&
+        std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                     void>::value>::type* = nullptr) {
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::value_type,
+                   typename ViewTraits<ST, SP...>::non_const_value_type>::value,
+      "deep_copy requires matching non-const destination type");
+
+  Kokkos::deep_copy(space, dst.view(), value);
+}
+
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const ExecSpace& space, const View<DT, DP...>& dst,
+    const Experimental::OffsetView<ST, SP...>& value,
+    typename std::enable_if<
+        Kokkos::Impl::is_execution_space<ExecSpace>::value &&
+        std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                     void>::value>::type* = nullptr) {
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::value_type,
+                   typename ViewTraits<ST, SP...>::non_const_value_type>::value,
+      "deep_copy requires matching non-const destination type");
+
+  Kokkos::deep_copy(space, dst, value.view());
+}
+
 namespace Impl {
 
 // Deduce Mirror Types
@@ -2093,4 +2162,79 @@ create_mirror_view(const Space&,
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/// Iteration policy over the index space of an OffsetView: a RangePolicy
+/// for rank one, otherwise an MDRangePolicy iterating in the order of the
+/// View layout so the innermost loop walks the stride-one dimension.
+template <class OffsetViewType, unsigned Rank = OffsetViewType::Rank>
+struct OffsetViewPolicy {
+  using execution_space = typename OffsetViewType::execution_space;
+  static constexpr Kokkos::Iterate iterate =
+      std::is_same<typename OffsetViewType::array_layout,
+                   Kokkos::LayoutLeft>::value
+          ? Kokkos::Iterate::Left
+          : Kokkos::Iterate::Right;
+  using type =
+      Kokkos::MDRangePolicy<execution_space,
+                            Kokkos::Rank<Rank, iterate, iterate>,
+                            Kokkos::IndexType<int64_t> >;
+
+  static type create(const OffsetViewType& v, const bool origin,
+                     const int64_t halo) {
+    typename type::point_type lower, upper;
+    for (unsigned r = 0; r < Rank; ++r) {
+      const int64_t base = origin ? v.begin(r) : 0;
+      lower[r]           = base + halo;
+      upper[r]           = base + int64_t(v.extent(r)) - halo;
+      if (upper[r] < lower[r]) upper[r] = lower[r];
+    }
+    return type(lower, upper);
+  }
+};
+
+template <class OffsetViewType>
+struct OffsetViewPolicy<OffsetViewType, 1> {
+  using execution_space = typename OffsetViewType::execution_space;
+  using type =
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t> >;
+
+  static type create(const OffsetViewType& v, const bool origin,
+                     const int64_t halo) {
+    const int64_t base  = origin ? v.begin(0) : 0;
+    const int64_t lower = base + halo;
+    const int64_t upper = base + int64_t(v.extent(0)) - halo;
+    return type(lower, upper < lower ? lower : upper);
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Policy over the index space [begin + halo, end - halo) of an
+ *          OffsetView, for kernels indexing the OffsetView itself.
+ */
+template <class D, class... P>
+typename Impl::OffsetViewPolicy<OffsetView<D, P...> >::type
+index_space_policy(const OffsetView<D, P...>& v, const int64_t halo = 0) {
+  return Impl::OffsetViewPolicy<OffsetView<D, P...> >::create(v, true, halo);
+}
+
+/** \brief  Policy over the zero-based index space [halo, extent - halo) of
+ *          the View underlying an OffsetView.
+ *
+ *  Kernels index v.view() directly, so no begins are subtracted per
+ *  access; index i of dimension r corresponds to OffsetView index
+ *  i + v.begin(r).
+ */
+template <class D, class... P>
+typename Impl::OffsetViewPolicy<OffsetView<D, P...> >::type
+zero_based_policy(const OffsetView<D, P...>& v, const int64_t halo = 0) {
+  return Impl::OffsetViewPolicy<OffsetView<D, P...> >::create(v, false, halo);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 #endif /* KOKKOS_OFFSETVIEW_HPP_ */
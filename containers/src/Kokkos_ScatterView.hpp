@@ -69,6 +69,8 @@ struct ScatterMin {};
 
 struct ScatterNonDuplicated {};
 struct ScatterDuplicated {};
+struct ScatterDuplicatedTracked {};
+struct ScatterHybrid {};
 
 struct ScatterNonAtomic {};
 struct ScatterAtomic {};
@@ -86,6 +88,20 @@ struct DefaultDuplication;
 template <typename ExecSpace, typename Duplication>
 struct DefaultContribution;
 
+// Tracked duplication contributes like plain duplication
+template <typename ExecSpace>
+struct DefaultContribution<ExecSpace,
+                           Kokkos::Experimental::ScatterDuplicatedTracked> {
+  using type = typename DefaultContribution<
+      ExecSpace, Kokkos::Experimental::ScatterDuplicated>::type;
+};
+
+// Hybrid mode flushes evicted contributions with atomics
+template <typename ExecSpace>
+struct DefaultContribution<ExecSpace, Kokkos::Experimental::ScatterHybrid> {
+  using type = Kokkos::Experimental::ScatterAtomic;
+};
+
 #ifdef KOKKOS_ENABLE_SERIAL
 template <>
 struct DefaultDuplication<Kokkos::Serial> {
@@ -392,7 +408,7 @@ struct ScatterValue<ValueType, Kokkos::Experimental::ScatterProd, DeviceType,
   }
 
   KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) {
-    atomic_prod(&value, rhs);
+    Kokkos::atomic_mul(&value, rhs);
   }
   KOKKOS_FORCEINLINE_FUNCTION void reset() {
     value = reduction_identity<ValueType>::prod();
@@ -713,6 +729,111 @@ struct ResetDuplicates : public ResetDuplicatesBase<ExecSpace, ValueType, Op> {
   }
 };
 
+/* ReduceTouchedDuplicates -- Perform reduction on destination array using only
+ *    the blocks of each duplicate that were touched since the last reset.
+ *    The touched blocks of duplicate j are the set bits of
+ *    touched[j * words : (j + 1) * words].  One work item handles the blocks
+ *    of one word of every duplicate, so the bits can be updated without
+ *    atomics.  If the destination aliases duplicate 0 its untouched blocks
+ *    are reset to the identity first and all of its blocks are marked
+ *    touched. */
+template <typename ExecSpace, typename ValueType, typename Op>
+struct ReduceTouchedDuplicates {
+  ValueType const* src;
+  ValueType* dst;
+  uint32_t* touched;
+  size_t words;
+  size_t span;
+  size_t block_shift;
+  size_t start;
+  size_t n;
+
+  ReduceTouchedDuplicates(ValueType const* src_in, ValueType* dst_in,
+                          uint32_t* touched_in, size_t words_in,
+                          size_t span_in, size_t block_shift_in,
+                          size_t start_in, size_t n_in,
+                          std::string const& name)
+      : src(src_in),
+        dst(dst_in),
+        touched(touched_in),
+        words(words_in),
+        span(span_in),
+        block_shift(block_shift_in),
+        start(start_in),
+        n(n_in) {
+    parallel_for(std::string("Kokkos::ScatterView::ReduceTouchedDuplicates [") +
+                     name + "]",
+                 RangePolicy<ExecSpace, size_t>(0, words), *this);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t w) const {
+    if (start == 1) {
+      for (uint32_t bits = ~touched[w]; bits; bits &= bits - 1) {
+        const size_t begin = block_begin(w, bits);
+        const size_t end   = block_end(begin);
+        for (size_t i = begin; i < end; ++i) {
+          ScatterValue<ValueType, Op, ExecSpace,
+                       Kokkos::Experimental::ScatterNonAtomic>
+              sv(dst[i]);
+          sv.reset();
+        }
+      }
+      touched[w] = ~uint32_t(0);
+    }
+    for (size_t j = start; j < n; ++j) {
+      for (uint32_t bits = touched[j * words + w]; bits; bits &= bits - 1) {
+        const size_t begin = block_begin(w, bits);
+        const size_t end   = block_end(begin);
+        for (size_t i = begin; i < end; ++i) {
+          ScatterValue<ValueType, Op, ExecSpace,
+                       Kokkos::Experimental::ScatterNonAtomic>
+              sv(dst[i]);
+          sv.update(src[i + span * j]);
+        }
+      }
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION size_t block_begin(size_t w,
+                                                 uint32_t bits) const {
+    return ((w << 5) + Kokkos::Impl::bit_scan_forward(bits)) << block_shift;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION size_t block_end(size_t begin) const {
+    return begin + (size_t(1) << block_shift) < span
+               ? begin + (size_t(1) << block_shift)
+               : span;
+  }
+};
+
+/* FlushCachedContributions -- Atomically contribute the entries of the
+ *    per-thread caches of ScatterHybrid to the destination array.  Entry i
+ *    of the caches holds the value accumulated for the destination offset
+ *    keys[i], or is empty if keys[i] == ~size_t(0). */
+template <typename ExecSpace, typename ValueType, typename Op>
+struct FlushCachedContributions {
+  size_t const* keys;
+  ValueType const* values;
+  ValueType* dst;
+
+  FlushCachedContributions(size_t const* keys_in, ValueType const* values_in,
+                           ValueType* dst_in, size_t size_in,
+                           std::string const& name)
+      : keys(keys_in), values(values_in), dst(dst_in) {
+    parallel_for(
+        std::string("Kokkos::ScatterView::FlushCachedContributions [") + name +
+            "]",
+        RangePolicy<ExecSpace, size_t>(0, size_in), *this);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t i) const {
+    if (keys[i] == ~size_t(0)) return;
+    ScatterValue<ValueType, Op, ExecSpace, Kokkos::Experimental::ScatterAtomic>
+        sv(dst[keys[i]]);
+    sv.update(values[i]);
+  }
+};
+
 }  // namespace Experimental
 }  // namespace Impl
 }  // namespace Kokkos
@@ -928,34 +1049,13 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
 
   template <typename RT, typename... RP>
   ScatterView(View<RT, RP...> const& original_view)
-      : unique_token(),
-        internal_view(
-            view_alloc(WithoutInitializing,
-                       std::string("duplicated_") + original_view.label()),
-            unique_token.size(),
-            original_view.rank_dynamic > 0 ? original_view.extent(0)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 1 ? original_view.extent(1)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 2 ? original_view.extent(2)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 3 ? original_view.extent(3)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 4 ? original_view.extent(4)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 5 ? original_view.extent(5)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-            original_view.rank_dynamic > 6 ? original_view.extent(6)
-                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG)
-
-  {
+      : ScatterView(Kokkos::Impl::WithoutInitializing_t{}, original_view) {
     reset();
   }
 
   template <typename... Dims>
   ScatterView(std::string const& name, Dims... dims)
-      : internal_view(view_alloc(WithoutInitializing, name),
-                      unique_token.size(), dims...) {
+      : ScatterView(Kokkos::Impl::WithoutInitializing_t{}, name, dims...) {
     reset();
   }
 
@@ -1032,6 +1132,37 @@ class ScatterView<DataType, Kokkos::LayoutRight, DeviceType, Op,
   }
 
  protected:
+  // Allocate the duplicates without resetting them
+  template <typename RT, typename... RP>
+  ScatterView(Kokkos::Impl::WithoutInitializing_t,
+              View<RT, RP...> const& original_view)
+      : unique_token(),
+        internal_view(
+            view_alloc(WithoutInitializing,
+                       std::string("duplicated_") + original_view.label()),
+            unique_token.size(),
+            original_view.rank_dynamic > 0 ? original_view.extent(0)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 1 ? original_view.extent(1)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 2 ? original_view.extent(2)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 3 ? original_view.extent(3)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 4 ? original_view.extent(4)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 5 ? original_view.extent(5)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+            original_view.rank_dynamic > 6 ? original_view.extent(6)
+                                           : KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+  }
+
+  template <typename... Dims>
+  ScatterView(Kokkos::Impl::WithoutInitializing_t, std::string const& name,
+              Dims... dims)
+      : internal_view(view_alloc(WithoutInitializing, name),
+                      unique_token.size(), dims...) {}
+
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int rank,
                                                          Args... args) const {
@@ -1075,54 +1206,14 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
   ScatterView() = default;
 
   template <typename RT, typename... RP>
-  ScatterView(View<RT, RP...> const& original_view) : unique_token() {
-    size_t arg_N[8] = {original_view.rank > 0 ? original_view.extent(0)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 1 ? original_view.extent(1)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 2 ? original_view.extent(2)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 3 ? original_view.extent(3)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 4 ? original_view.extent(4)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 5 ? original_view.extent(5)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 6 ? original_view.extent(6)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       KOKKOS_IMPL_CTOR_DEFAULT_ARG};
-    arg_N[internal_view_type::rank - 1] = unique_token.size();
-    internal_view                       = internal_view_type(
-        view_alloc(WithoutInitializing,
-                   std::string("duplicated_") + original_view.label()),
-        arg_N[0], arg_N[1], arg_N[2], arg_N[3], arg_N[4], arg_N[5], arg_N[6],
-        arg_N[7]);
+  ScatterView(View<RT, RP...> const& original_view)
+      : ScatterView(Kokkos::Impl::WithoutInitializing_t{}, original_view) {
     reset();
   }
 
   template <typename... Dims>
-  ScatterView(std::string const& name, Dims... dims) {
-    original_view_type original_view;
-    size_t arg_N[8] = {original_view.rank > 0 ? original_view.static_extent(0)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 1 ? original_view.static_extent(1)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 2 ? original_view.static_extent(2)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 3 ? original_view.static_extent(3)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 4 ? original_view.static_extent(4)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 5 ? original_view.static_extent(5)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       original_view.rank > 6 ? original_view.static_extent(6)
-                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-                       KOKKOS_IMPL_CTOR_DEFAULT_ARG};
-    Kokkos::Impl::Experimental::args_to_array(arg_N, 0, dims...);
-    arg_N[internal_view_type::rank - 1] = unique_token.size();
-    internal_view = internal_view_type(view_alloc(WithoutInitializing, name),
-                                       arg_N[0], arg_N[1], arg_N[2], arg_N[3],
-                                       arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
+  ScatterView(std::string const& name, Dims... dims)
+      : ScatterView(Kokkos::Impl::WithoutInitializing_t{}, name, dims...) {
     reset();
   }
 
@@ -1228,6 +1319,60 @@ class ScatterView<DataType, Kokkos::LayoutLeft, DeviceType, Op,
   }
 
  protected:
+  // Allocate the duplicates without resetting them
+  template <typename RT, typename... RP>
+  ScatterView(Kokkos::Impl::WithoutInitializing_t,
+              View<RT, RP...> const& original_view)
+      : unique_token() {
+    size_t arg_N[8] = {original_view.rank > 0 ? original_view.extent(0)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 1 ? original_view.extent(1)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 2 ? original_view.extent(2)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 3 ? original_view.extent(3)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 4 ? original_view.extent(4)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 5 ? original_view.extent(5)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 6 ? original_view.extent(6)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       KOKKOS_IMPL_CTOR_DEFAULT_ARG};
+    arg_N[internal_view_type::rank - 1] = unique_token.size();
+    internal_view                       = internal_view_type(
+        view_alloc(WithoutInitializing,
+                   std::string("duplicated_") + original_view.label()),
+        arg_N[0], arg_N[1], arg_N[2], arg_N[3], arg_N[4], arg_N[5], arg_N[6],
+        arg_N[7]);
+  }
+
+  template <typename... Dims>
+  ScatterView(Kokkos::Impl::WithoutInitializing_t, std::string const& name,
+              Dims... dims) {
+    original_view_type original_view;
+    size_t arg_N[8] = {original_view.rank > 0 ? original_view.static_extent(0)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 1 ? original_view.static_extent(1)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 2 ? original_view.static_extent(2)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 3 ? original_view.static_extent(3)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 4 ? original_view.static_extent(4)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 5 ? original_view.static_extent(5)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       original_view.rank > 6 ? original_view.static_extent(6)
+                                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       KOKKOS_IMPL_CTOR_DEFAULT_ARG};
+    Kokkos::Impl::Experimental::args_to_array(arg_N, 0, dims...);
+    arg_N[internal_view_type::rank - 1] = unique_token.size();
+    internal_view = internal_view_type(view_alloc(WithoutInitializing, name),
+                                       arg_N[0], arg_N[1], arg_N[2], arg_N[3],
+                                       arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
+  }
+
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int thread_id,
                                                          Args... args) const {
@@ -1310,6 +1455,524 @@ class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterDuplicated,
   thread_id_type thread_id;
 };
 
+// duplicated implementation tracking the touched blocks of each duplicate
+//
+// The duplicates are allocated without initialization and are divided into
+// blocks of 2^block_shift entries.  The first access of a thread to a block
+// resets that block of its duplicate and marks it in a per-thread bitset.
+// contribute_into() then only reduces the marked blocks and reset() only
+// clears the marks, so the cost of both scales with the touched region
+// rather than with the number of threads times the size of the view.
+// Blocks that are never touched are never written, which lets the operating
+// system defer backing them with physical memory.
+//
+// Entries of subview() are only valid after contributing into it.
+// resize() and realloc() discard pending contributions.
+
+template <typename DataType, typename Layout, typename DeviceType, typename Op,
+          typename Contribution>
+class ScatterView<DataType, Layout, DeviceType, Op, ScatterDuplicatedTracked,
+                  Contribution> {
+ public:
+  using duplicated_type = ScatterView<DataType, Layout, DeviceType, Op,
+                                      ScatterDuplicated, Contribution>;
+  using execution_space         = typename duplicated_type::execution_space;
+  using memory_space            = typename duplicated_type::memory_space;
+  using device_type             = typename duplicated_type::device_type;
+  using original_view_type      = typename duplicated_type::original_view_type;
+  using original_value_type     = typename duplicated_type::original_value_type;
+  using original_reference_type =
+      typename duplicated_type::original_reference_type;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout,
+                             ScatterDuplicatedTracked, Contribution,
+                             ScatterNonAtomic>;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout,
+                             ScatterDuplicatedTracked, Contribution,
+                             ScatterAtomic>;
+  template <class, class, class, class, class, class>
+  friend class ScatterView;
+
+  using touched_view_type =
+      Kokkos::View<uint32_t**, Kokkos::LayoutRight, device_type>;
+
+  // Blocks of 4096 bytes for 8 byte values
+  enum : size_t { block_shift = 9 };
+
+  ScatterView() = default;
+
+  template <typename RT, typename... RP>
+  ScatterView(View<RT, RP...> const& original_view)
+      : duplicated_view(Kokkos::Impl::WithoutInitializing_t{}, original_view) {
+    allocate_touched();
+  }
+
+  template <typename... Dims>
+  ScatterView(std::string const& name, Dims... dims)
+      : duplicated_view(Kokkos::Impl::WithoutInitializing_t{}, name, dims...) {
+    allocate_touched();
+  }
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION ScatterView(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterDuplicatedTracked, Contribution>& other_view)
+      : duplicated_view(other_view.duplicated_view),
+        touched_blocks(other_view.touched_blocks),
+        copy_span(other_view.copy_span) {}
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION void operator=(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterDuplicatedTracked, Contribution>& other_view) {
+    duplicated_view = other_view.duplicated_view;
+    touched_blocks  = other_view.touched_blocks;
+    copy_span       = other_view.copy_span;
+  }
+
+  template <typename OverrideContribution = Contribution>
+  KOKKOS_FORCEINLINE_FUNCTION
+      ScatterAccess<DataType, Op, DeviceType, Layout, ScatterDuplicatedTracked,
+                    Contribution, OverrideContribution>
+      access() const {
+    return ScatterAccess<DataType, Op, DeviceType, Layout,
+                         ScatterDuplicatedTracked, Contribution,
+                         OverrideContribution>(*this);
+  }
+
+  auto subview() const -> decltype(std::declval<duplicated_type>().subview()) {
+    return duplicated_view.subview();
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return duplicated_view.is_allocated();
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest) const {
+    using dest_type = View<DT, RP...>;
+    static_assert(std::is_same<typename dest_type::array_layout, Layout>::value,
+                  "ScatterView deep_copy destination has different layout");
+    static_assert(
+        Kokkos::Impl::VerifyExecutionCanAccessMemorySpace<
+            memory_space, typename dest_type::memory_space>::value,
+        "ScatterView deep_copy destination memory space not accessible");
+    auto const& internal_view = duplicated_view.internal_view;
+    bool is_equal             = (dest.data() == internal_view.data());
+    size_t start              = is_equal ? 1 : 0;
+    Kokkos::Impl::Experimental::ReduceTouchedDuplicates<
+        execution_space, original_value_type, Op>(
+        internal_view.data(), dest.data(), touched_blocks.data(),
+        touched_blocks.extent(1), copy_span, block_shift, start,
+        touched_blocks.extent(0), internal_view.label());
+  }
+
+  void reset() { Kokkos::deep_copy(touched_blocks, uint32_t(0)); }
+
+  template <typename DT, typename... RP>
+  void reset_except(View<DT, RP...> const& view) {
+    if (view.data() != duplicated_view.internal_view.data()) {
+      reset();
+      return;
+    }
+    // The excepted duplicate holds valid entries in all of its blocks
+    Kokkos::deep_copy(
+        Kokkos::subview(touched_blocks, 0, Kokkos::ALL),
+        ~uint32_t(0));
+    Kokkos::deep_copy(
+        Kokkos::subview(touched_blocks,
+                        std::make_pair(size_t(1), touched_blocks.extent(0)),
+                        Kokkos::ALL),
+        uint32_t(0));
+  }
+
+  void resize(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+              const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+              const size_t n6 = 0) {
+    realloc(n0, n1, n2, n3, n4, n5, n6);
+  }
+
+  void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+               const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+               const size_t n6 = 0) {
+    duplicated_view.realloc(n0, n1, n2, n3, n4, n5, n6);
+    allocate_touched();
+  }
+
+ protected:
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int thread_id,
+                                                         Args... args) const {
+    return duplicated_view.at(thread_id, args...);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION original_value_type* copy_data(
+      int thread_id) const {
+    return duplicated_view.internal_view.data() + copy_span * thread_id;
+  }
+
+  // Reset the block of a duplicate when it is first touched
+  KOKKOS_INLINE_FUNCTION void touch(int thread_id, size_t block) const {
+    uint32_t& word      = touched_blocks(thread_id, block >> 5);
+    const uint32_t mask = uint32_t(1) << (block & 31);
+    if (word & mask) return;
+    word |= mask;
+    original_value_type* const copy = copy_data(thread_id);
+    const size_t begin              = block << block_shift;
+    const size_t end = begin + (size_t(1) << block_shift) < copy_span
+                           ? begin + (size_t(1) << block_shift)
+                           : copy_span;
+    for (size_t i = begin; i < end; ++i) {
+      Kokkos::Impl::Experimental::ScatterValue<
+          original_value_type, Op, DeviceType,
+          Kokkos::Experimental::ScatterNonAtomic>
+          sv(copy[i]);
+      sv.reset();
+    }
+  }
+
+  void allocate_touched() {
+    auto const& internal_view = duplicated_view.internal_view;
+    const size_t count        = unique_token().size();
+    copy_span                 = internal_view.size() / count;
+    const size_t blocks = (copy_span + (size_t(1) << block_shift) - 1) >>
+                          block_shift;
+    touched_blocks = touched_view_type(
+        std::string("touched_") + internal_view.label(), count,
+        (blocks + 31) >> 5);
+  }
+
+ protected:
+  using unique_token_type = typename duplicated_type::unique_token_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION unique_token_type const& unique_token() const {
+    return duplicated_view.unique_token;
+  }
+
+  duplicated_type duplicated_view;
+  touched_view_type touched_blocks;
+  size_t copy_span = 0;
+};
+
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution, typename OverrideContribution>
+class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterDuplicatedTracked,
+                    Contribution, OverrideContribution> {
+ public:
+  using view_type           = ScatterView<DataType, Layout, DeviceType, Op,
+                                ScatterDuplicatedTracked, Contribution>;
+  using original_value_type = typename view_type::original_value_type;
+  using value_type          = Kokkos::Impl::Experimental::ScatterValue<
+      original_value_type, Op, DeviceType, OverrideContribution>;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(view_type const& view_in)
+      : view(view_in),
+        thread_id(view_in.unique_token().acquire()),
+        copy(view_in.copy_data(thread_id)),
+        last_block(~size_t(0)) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ~ScatterAccess() {
+    if (thread_id != ~thread_id_type(0))
+      view.unique_token().release(thread_id);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator()(Args... args) const {
+    return touch(view.at(thread_id, args...));
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<view_type::original_view_type::rank == 1 &&
+                                  std::is_integral<Arg>::value,
+                              value_type>::type
+      operator[](Arg arg) const {
+    return touch(view.at(thread_id, arg));
+  }
+
+ private:
+  using original_reference_type = typename view_type::original_reference_type;
+
+  // Consecutive accesses to the same block skip the touched bitset
+  KOKKOS_FORCEINLINE_FUNCTION original_reference_type
+  touch(original_reference_type ref) const {
+    const size_t block = size_t(&ref - copy) >> view_type::block_shift;
+    if (block != last_block) {
+      view.touch(thread_id, block);
+      last_block = block;
+    }
+    return ref;
+  }
+
+  view_type const& view;
+
+  // simplify RAII by disallowing copies
+  ScatterAccess(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess&& other) = delete;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(ScatterAccess&& other)
+      : view(other.view),
+        thread_id(other.thread_id),
+        copy(other.copy),
+        last_block(other.last_block) {
+    other.thread_id = ~thread_id_type(0);
+  }
+
+ private:
+  using unique_token_type = typename view_type::unique_token_type;
+  using thread_id_type    = typename unique_token_type::size_type;
+  thread_id_type thread_id;
+  original_value_type* copy;
+  mutable size_t last_block;
+};
+
+// hybrid implementation
+//
+// Contributions go to a small direct-mapped cache per thread, indexed by the
+// offset of the contributed entry.  Repeated contributions to an entry that
+// stays cached (a "hot" entry) are plain updates of thread-private memory.
+// Contributing to an entry that maps to an occupied cache slot evicts the
+// slot by atomically contributing its value to the view, so "cold" entries
+// cost one atomic update as with ScatterNonDuplicated and ScatterAtomic.
+// Like ScatterNonDuplicated the view wraps the original view directly;
+// contribute() flushes the remaining cache entries atomically and reset()
+// empties the caches.
+
+template <typename DataType, typename Layout, typename DeviceType, typename Op,
+          typename Contribution>
+class ScatterView<DataType, Layout, DeviceType, Op, ScatterHybrid,
+                  Contribution> {
+ public:
+  using execution_space         = typename DeviceType::execution_space;
+  using memory_space            = typename DeviceType::memory_space;
+  using device_type             = Kokkos::Device<execution_space, memory_space>;
+  using original_view_type      = Kokkos::View<DataType, Layout, device_type>;
+  using original_value_type     = typename original_view_type::value_type;
+  using original_reference_type = typename original_view_type::reference_type;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterHybrid,
+                             Contribution, ScatterNonAtomic>;
+  friend class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterHybrid,
+                             Contribution, ScatterAtomic>;
+  template <class, class, class, class, class, class>
+  friend class ScatterView;
+
+  using cache_keys_type =
+      Kokkos::View<size_t**, Kokkos::LayoutRight, device_type>;
+  using cache_values_type =
+      Kokkos::View<original_value_type**, Kokkos::LayoutRight, device_type>;
+
+  // Number of cached entries per thread
+  enum : size_t { cache_size = 64 };
+
+  ScatterView() = default;
+
+  template <typename RT, typename... RP>
+  ScatterView(View<RT, RP...> const& original_view)
+      : internal_view(original_view) {
+    allocate_caches();
+  }
+
+  template <typename... Dims>
+  ScatterView(std::string const& name, Dims... dims)
+      : internal_view(name, dims...) {
+    allocate_caches();
+  }
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION ScatterView(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterHybrid, Contribution>& other_view)
+      : unique_token(other_view.unique_token),
+        internal_view(other_view.internal_view),
+        cache_keys(other_view.cache_keys),
+        cache_values(other_view.cache_values) {}
+
+  template <typename OtherDataType, typename OtherDeviceType>
+  KOKKOS_FUNCTION void operator=(
+      const ScatterView<OtherDataType, Layout, OtherDeviceType, Op,
+                        ScatterHybrid, Contribution>& other_view) {
+    unique_token  = other_view.unique_token;
+    internal_view = other_view.internal_view;
+    cache_keys    = other_view.cache_keys;
+    cache_values  = other_view.cache_values;
+  }
+
+  template <typename OverrideContribution = Contribution>
+  KOKKOS_FORCEINLINE_FUNCTION
+      ScatterAccess<DataType, Op, DeviceType, Layout, ScatterHybrid,
+                    Contribution, OverrideContribution>
+      access() const {
+    return ScatterAccess<DataType, Op, DeviceType, Layout, ScatterHybrid,
+                         Contribution, OverrideContribution>(*this);
+  }
+
+  original_view_type subview() const { return internal_view; }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return internal_view.is_allocated();
+  }
+
+  template <typename DT, typename... RP>
+  void contribute_into(View<DT, RP...> const& dest) const {
+    using dest_type = View<DT, RP...>;
+    static_assert(std::is_same<typename dest_type::array_layout, Layout>::value,
+                  "ScatterView contribute destination has different layout");
+    static_assert(
+        Kokkos::Impl::VerifyExecutionCanAccessMemorySpace<
+            memory_space, typename dest_type::memory_space>::value,
+        "ScatterView contribute destination memory space not accessible");
+    if (dest.data() != internal_view.data()) {
+      Kokkos::Impl::Experimental::ReduceDuplicates<execution_space,
+                                                   original_value_type, Op>(
+          internal_view.data(), dest.data(), internal_view.span(), 0, 1,
+          internal_view.label());
+    }
+    Kokkos::Impl::Experimental::FlushCachedContributions<
+        execution_space, original_value_type, Op>(
+        cache_keys.data(), cache_values.data(), dest.data(), cache_keys.size(),
+        internal_view.label());
+  }
+
+  void reset() {
+    Kokkos::Impl::Experimental::ResetDuplicates<execution_space,
+                                                original_value_type, Op>(
+        internal_view.data(), internal_view.size(), internal_view.label());
+    Kokkos::deep_copy(cache_keys, ~size_t(0));
+  }
+
+  template <typename DT, typename... RP>
+  void reset_except(View<DT, RP...> const& view) {
+    if (view.data() != internal_view.data()) {
+      reset();
+      return;
+    }
+    Kokkos::deep_copy(cache_keys, ~size_t(0));
+  }
+
+  void resize(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+              const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+              const size_t n6 = 0, const size_t n7 = 0) {
+    ::Kokkos::resize(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+    Kokkos::deep_copy(cache_keys, ~size_t(0));
+  }
+
+  void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
+               const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
+               const size_t n6 = 0, const size_t n7 = 0) {
+    ::Kokkos::realloc(internal_view, n0, n1, n2, n3, n4, n5, n6, n7);
+    Kokkos::deep_copy(cache_keys, ~size_t(0));
+  }
+
+ protected:
+  // Cached value accumulating the contributions of a thread to an entry
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION original_value_type& at(int thread_id,
+                                                      Args... args) const {
+    original_value_type* const base = internal_view.data();
+    const size_t key = size_t(&internal_view(args...) - base);
+    const size_t slot = key & (cache_size - 1);
+    size_t& cached_key = cache_keys(thread_id, slot);
+    original_value_type& cached_value = cache_values(thread_id, slot);
+    if (cached_key != key) {
+      if (cached_key != ~size_t(0)) {
+        Kokkos::Impl::Experimental::ScatterValue<
+            original_value_type, Op, DeviceType,
+            Kokkos::Experimental::ScatterAtomic>
+            sv(base[cached_key]);
+        sv.update(cached_value);
+      }
+      cached_key = key;
+      Kokkos::Impl::Experimental::ScatterValue<
+          original_value_type, Op, DeviceType,
+          Kokkos::Experimental::ScatterNonAtomic>
+          sv(cached_value);
+      sv.reset();
+    }
+    return cached_value;
+  }
+
+  void allocate_caches() {
+    cache_keys = cache_keys_type(
+        view_alloc(WithoutInitializing,
+                   std::string("cache_keys_") + internal_view.label()),
+        unique_token.size(), size_t(cache_size));
+    cache_values = cache_values_type(
+        view_alloc(WithoutInitializing,
+                   std::string("cache_values_") + internal_view.label()),
+        unique_token.size(), size_t(cache_size));
+    Kokkos::deep_copy(cache_keys, ~size_t(0));
+  }
+
+ protected:
+  using unique_token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  unique_token_type unique_token;
+  original_view_type internal_view;
+  cache_keys_type cache_keys;
+  cache_values_type cache_values;
+};
+
+template <typename DataType, typename Op, typename DeviceType, typename Layout,
+          typename Contribution, typename OverrideContribution>
+class ScatterAccess<DataType, Op, DeviceType, Layout, ScatterHybrid,
+                    Contribution, OverrideContribution> {
+ public:
+  using view_type           = ScatterView<DataType, Layout, DeviceType, Op,
+                                ScatterHybrid, Contribution>;
+  using original_value_type = typename view_type::original_value_type;
+  // The cached value is private to the thread
+  using value_type = Kokkos::Impl::Experimental::ScatterValue<
+      original_value_type, Op, DeviceType, ScatterNonAtomic>;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(view_type const& view_in)
+      : view(view_in), thread_id(view_in.unique_token.acquire()) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ~ScatterAccess() {
+    if (thread_id != ~thread_id_type(0)) view.unique_token.release(thread_id);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator()(Args... args) const {
+    return view.at(thread_id, args...);
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<view_type::original_view_type::rank == 1 &&
+                                  std::is_integral<Arg>::value,
+                              value_type>::type
+      operator[](Arg arg) const {
+    return view.at(thread_id, arg);
+  }
+
+ private:
+  view_type const& view;
+
+  // simplify RAII by disallowing copies
+  ScatterAccess(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess const& other) = delete;
+  ScatterAccess& operator=(ScatterAccess&& other) = delete;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  ScatterAccess(ScatterAccess&& other)
+      : view(other.view), thread_id(other.thread_id) {
+    other.thread_id = ~thread_id_type(0);
+  }
+
+ private:
+  using unique_token_type = typename view_type::unique_token_type;
+  using thread_id_type    = typename unique_token_type::size_type;
+  thread_id_type thread_id;
+};
+
 template <typename Op          = Kokkos::Experimental::ScatterSum,
           typename Duplication = void, typename Contribution = void,
           typename RT, typename... RP>
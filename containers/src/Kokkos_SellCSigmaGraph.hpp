@@ -0,0 +1,401 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SELLCSIGMAGRAPH_HPP
+#define KOKKOS_SELLCSIGMAGRAPH_HPP
+
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_StaticCrsGraph.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/// Default chunk height: one SIMD register of 32-bit lanes on host
+/// backends, a warp on device backends.
+template <class ExecutionSpace>
+struct SellCSigmaDefaultChunkSize {
+  static constexpr unsigned value =
+      Kokkos::Impl::SpaceAccessibility<
+          Kokkos::HostSpace,
+          typename ExecutionSpace::memory_space>::accessible
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_ARCH_AVX512MIC)
+          ? 16
+#elif defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX)
+          ? 8
+#else
+          ? 4
+#endif
+          : 32;
+};
+
+/// Sorts the rows of each sigma-window by decreasing length (ties by row
+/// index) into the row permutation.
+template <class RowMapType, class PermutationType>
+struct SellCSigmaSortWindows {
+  using size_type = typename PermutationType::non_const_value_type;
+
+  RowMapType row_map;
+  PermutationType permutation;
+  size_type num_rows;
+  size_type sigma;
+
+  KOKKOS_INLINE_FUNCTION
+  size_type length(const size_type row) const {
+    return size_type(row_map(row + 1) - row_map(row));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool before(const size_type a, const size_type b) const {
+    const size_type la = length(a), lb = length(b);
+    return (la > lb) || (la == lb && a < b);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void sift_down(const size_type base, size_type root,
+                 const size_type n) const {
+    const size_type value = permutation(base + root);
+    size_type child;
+    while ((child = 2 * root + 1) < n) {
+      if (child + 1 < n &&
+          before(permutation(base + child), permutation(base + child + 1)))
+        ++child;
+      if (!before(value, permutation(base + child))) break;
+      permutation(base + root) = permutation(base + child);
+      root                     = child;
+    }
+    permutation(base + root) = value;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type w) const {
+    const size_type base = w * sigma;
+    const size_type n =
+        (num_rows - base < sigma) ? num_rows - base : sigma;
+    for (size_type i = 0; i < n; ++i) permutation(base + i) = base + i;
+    for (size_type k = n / 2; k-- > 0;) sift_down(base, k, n);
+    for (size_type last = n ? n - 1 : 0; last > 0; --last) {
+      const size_type top        = permutation(base);
+      permutation(base)          = permutation(base + last);
+      permutation(base + last)   = top;
+      sift_down(base, 0, last);
+    }
+  }
+};
+
+/// Records the row and length of every slot and the padded size of every
+/// chunk.  Slots beyond the last row hold num_rows and length zero.
+template <class RowMapType, class WorkType>
+struct SellCSigmaChunkSizes {
+  using size_type = typename WorkType::non_const_value_type;
+
+  RowMapType row_map;
+  WorkType permutation;
+  WorkType slot_rows;
+  WorkType row_lengths;
+  WorkType chunk_sizes;
+  size_type num_rows;
+  size_type chunk_size;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type k) const {
+    size_type width = 0;
+    for (size_type lane = 0; lane < chunk_size; ++lane) {
+      const size_type slot = k * chunk_size + lane;
+      size_type row = num_rows, len = 0;
+      if (slot < num_rows) {
+        row = permutation(slot);
+        len = size_type(row_map(row + 1) - row_map(row));
+      }
+      slot_rows(slot)   = row;
+      row_lengths(slot) = len;
+      if (width < len) width = len;
+    }
+    chunk_sizes(k) = width * chunk_size;
+  }
+};
+
+/// Copies the entries (or values) of every slot into its lane of the chunk,
+/// column-major so that consecutive lanes are contiguous.  Padding repeats
+/// the last entry of the row, or pad if the row is empty.
+template <class SellType, class RowMapType, class SrcType, class DstType>
+struct SellCSigmaFill {
+  using size_type  = typename SellType::size_type;
+  using value_type = typename DstType::non_const_value_type;
+
+  SellType sell;
+  RowMapType row_map;
+  SrcType src;
+  DstType dst;
+  bool repeat_last;
+  value_type pad;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type slot) const {
+    const size_type C     = sell.chunkSize();
+    const size_type k     = slot / C;
+    const size_type lane  = slot % C;
+    const size_type begin = sell.chunk_offsets(k);
+    const size_type width = (sell.chunk_offsets(k + 1) - begin) / C;
+    const size_type len   = sell.row_lengths(slot);
+    const size_type row   = sell.slot_rows(slot);
+    const size_type first = len ? size_type(row_map(row)) : 0;
+    const value_type fill =
+        (repeat_last && len) ? value_type(src(first + len - 1)) : pad;
+    for (size_type j = 0; j < width; ++j) {
+      dst(begin + j * C + lane) = j < len ? value_type(src(first + j)) : fill;
+    }
+  }
+};
+
+}  // namespace Impl
+
+/// \class SellCSigmaGraph
+/// \brief Sliced ELLPACK (SELL-C-sigma) storage of a sparse graph.
+///
+/// Rows are grouped into chunks of \c chunkSize() consecutive slots.  Each
+/// chunk is padded to the length of its longest row and stored
+/// column-major, so entry \c j of the rows of a chunk are contiguous:
+/// <tt> entries(chunk_offsets(k) + j * chunkSize() + lane) </tt>.
+/// Before chunking, the rows within each window of \c sigma() rows are
+/// sorted by decreasing length, which keeps the padding small while
+/// preserving locality.  \c slot_rows maps a slot (<tt> k * chunkSize() +
+/// lane </tt>) back to its row of the original graph; slots past the last
+/// row map to \c numRows().
+///
+/// Kernels iterate chunks with chunk_policy() (one chunk per work item,
+/// inner loop over the chunk lanes) or team_policy() (one chunk per team,
+/// ThreadVectorRange over the lanes).
+template <class DataType, class Arg1Type, class Arg2Type = void,
+          typename SizeType = typename ViewTraits<DataType*, Arg1Type, Arg2Type,
+                                                  void>::size_type>
+class SellCSigmaGraph {
+ private:
+  using traits = ViewTraits<DataType*, Arg1Type, Arg2Type, void>;
+
+ public:
+  using data_type       = DataType;
+  using array_layout    = typename traits::array_layout;
+  using execution_space = typename traits::execution_space;
+  using device_type     = typename traits::device_type;
+  using size_type       = SizeType;
+
+  static_assert(std::is_integral<data_type>::value,
+                "SellCSigmaGraph entries must be integral indices");
+
+  using entries_type   = View<data_type*, array_layout, device_type>;
+  using offsets_type   = View<const size_type*, array_layout, device_type>;
+  using slot_data_type = View<const size_type*, array_layout, device_type>;
+
+  entries_type entries;
+  offsets_type chunk_offsets;
+  slot_data_type slot_rows;
+  slot_data_type row_lengths;
+
+  size_type num_rows     = 0;
+  size_type chunk_size   = 1;
+  size_type sigma_window = 1;
+
+  //! Default chunk height for execution_space.
+  static constexpr size_type default_chunk_size() {
+    return Impl::SellCSigmaDefaultChunkSize<execution_space>::value;
+  }
+
+  KOKKOS_INLINE_FUNCTION size_type numRows() const { return num_rows; }
+  KOKKOS_INLINE_FUNCTION size_type chunkSize() const { return chunk_size; }
+  KOKKOS_INLINE_FUNCTION size_type sigma() const { return sigma_window; }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type numChunks() const {
+    return (chunk_offsets.extent(0) != 0)
+               ? chunk_offsets.extent(0) - static_cast<size_type>(1)
+               : static_cast<size_type>(0);
+  }
+
+  //! Number of entries stored per lane of chunk k, including padding.
+  KOKKOS_INLINE_FUNCTION
+  size_type chunk_width(const size_type k) const {
+    return (chunk_offsets(k + 1) - chunk_offsets(k)) / chunk_size;
+  }
+
+  //! Entry j of the row held by the given lane of chunk k.
+  KOKKOS_INLINE_FUNCTION
+  data_type& entry(const size_type k, const size_type j,
+                   const size_type lane) const {
+    return entries(chunk_offsets(k) + j * chunk_size + lane);
+  }
+
+  //! Row of the original graph held by the given lane of chunk k.
+  KOKKOS_INLINE_FUNCTION
+  size_type slot_row(const size_type k, const size_type lane) const {
+    return slot_rows(k * chunk_size + lane);
+  }
+
+  //! One iteration per chunk.
+  Kokkos::RangePolicy<execution_space> chunk_policy() const {
+    return Kokkos::RangePolicy<execution_space>(0, numChunks());
+  }
+
+  //! One team per chunk, with vector lanes matching the chunk height
+  //! where the backend supports it.
+  Kokkos::TeamPolicy<execution_space> team_policy() const {
+    using policy_type = Kokkos::TeamPolicy<execution_space>;
+    const int max_vector = policy_type::vector_length_max();
+    const int vector =
+        int(chunk_size) < max_vector ? int(chunk_size) : max_vector;
+    return policy_type(numChunks(), Kokkos::AUTO, vector);
+  }
+};
+
+/// \brief Convert a StaticCrsGraph to SELL-C-sigma storage in parallel.
+///
+/// \c chunk_size defaults to SellType::default_chunk_size() and \c sigma
+/// to 32 chunks; sigma is rounded up to a multiple of the chunk size.
+/// Padding entries repeat the last column index of their row (zero for
+/// empty rows), so padded gathers stay within the row's footprint.
+template <class SellType, class StaticCrsGraphType>
+SellType create_sell_c_sigma_graph(const std::string& label,
+                                   const StaticCrsGraphType& crs,
+                                   typename SellType::size_type chunk_size = 0,
+                                   typename SellType::size_type sigma = 0) {
+  using size_type       = typename SellType::size_type;
+  using execution_space = typename SellType::execution_space;
+  using work_type = View<size_type*, typename SellType::array_layout,
+                         typename SellType::device_type>;
+  using policy_type = RangePolicy<execution_space, IndexType<size_type> >;
+  using row_map_type = typename StaticCrsGraphType::row_map_type;
+
+  if (chunk_size == 0) chunk_size = SellType::default_chunk_size();
+  if (sigma == 0) sigma = 32 * chunk_size;
+  sigma = ((sigma + chunk_size - 1) / chunk_size) * chunk_size;
+
+  const size_type num_rows   = crs.numRows();
+  const size_type num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+  const size_type num_slots  = num_chunks * chunk_size;
+
+  SellType sell;
+  sell.num_rows     = num_rows;
+  sell.chunk_size   = chunk_size;
+  sell.sigma_window = sigma;
+
+  work_type permutation(view_alloc(WithoutInitializing, label + "::perm"),
+                        num_rows);
+  Kokkos::parallel_for(
+      "Kokkos::create_sell_c_sigma_graph::sort",
+      policy_type(0, (num_rows + sigma - 1) / sigma),
+      Impl::SellCSigmaSortWindows<row_map_type, work_type>{
+          crs.row_map, permutation, num_rows, sigma});
+
+  work_type slot_rows(view_alloc(WithoutInitializing, label + "::slot_rows"),
+                      num_slots);
+  work_type row_lengths(
+      view_alloc(WithoutInitializing, label + "::row_lengths"), num_slots);
+  work_type chunk_sizes(
+      view_alloc(WithoutInitializing, label + "::chunk_sizes"), num_chunks);
+  Kokkos::parallel_for(
+      "Kokkos::create_sell_c_sigma_graph::chunks",
+      policy_type(0, num_chunks),
+      Impl::SellCSigmaChunkSizes<row_map_type, work_type>{
+          crs.row_map, permutation, slot_rows, row_lengths, chunk_sizes,
+          num_rows, chunk_size});
+
+  work_type chunk_offsets;
+  const size_type num_entries = Kokkos::get_crs_row_map_from_counts(
+      chunk_offsets, chunk_sizes, label + "::chunk_offsets");
+
+  sell.chunk_offsets = chunk_offsets;
+  sell.slot_rows     = slot_rows;
+  sell.row_lengths   = row_lengths;
+  sell.entries       = typename SellType::entries_type(
+      view_alloc(WithoutInitializing, label), num_entries);
+
+  Kokkos::parallel_for(
+      "Kokkos::create_sell_c_sigma_graph::fill", policy_type(0, num_slots),
+      Impl::SellCSigmaFill<SellType, row_map_type,
+                           typename StaticCrsGraphType::entries_type,
+                           typename SellType::entries_type>{
+          sell, crs.row_map, crs.entries, sell.entries, true,
+          typename SellType::data_type(0)});
+  execution_space().fence();
+
+  return sell;
+}
+
+/// \brief Scatter per-entry values of a CRS matrix (e.g. matrix
+///        coefficients) into the SELL-C-sigma layout of \c sell, which
+///        must have been created from \c crs.  Padding values are zero.
+template <class SellType, class StaticCrsGraphType, class CrsValuesType,
+          class SellValuesType>
+void fill_sell_c_sigma_values(const SellType& sell,
+                              const StaticCrsGraphType& crs,
+                              const CrsValuesType& crs_values,
+                              const SellValuesType& sell_values) {
+  using size_type       = typename SellType::size_type;
+  using execution_space = typename SellType::execution_space;
+  using policy_type = RangePolicy<execution_space, IndexType<size_type> >;
+
+  if (sell_values.extent(0) != sell.entries.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::fill_sell_c_sigma_values: value view size does not match "
+        "the SELL-C-sigma graph");
+  }
+
+  Kokkos::parallel_for(
+      "Kokkos::fill_sell_c_sigma_values",
+      policy_type(0, sell.numChunks() * sell.chunkSize()),
+      Impl::SellCSigmaFill<SellType,
+                           typename StaticCrsGraphType::row_map_type,
+                           CrsValuesType, SellValuesType>{
+          sell, crs.row_map, crs_values, sell_values, false,
+          typename SellValuesType::non_const_value_type(0)});
+  execution_space().fence();
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SELLCSIGMAGRAPH_HPP */
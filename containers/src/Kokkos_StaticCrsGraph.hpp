@@ -130,6 +130,59 @@ struct StaticCrsGraphBalancerFunctor {
     }
   }
 };
+
+/// Row-granular merge-path partitioner.  Block b starts at the first row
+/// whose position along the merge path (entries plus a fixed cost per row
+/// preceding it) reaches b / num_blocks of the total work.  Each block is
+/// located independently with a binary search over the row offsets, so the
+/// partitioning costs O(num_blocks * log(num_rows)) work.
+template <class RowOffsetsType, class RowBlockOffsetsType>
+struct StaticCrsGraphMergePathFunctor {
+  using int_type = typename RowOffsetsType::non_const_value_type;
+  RowOffsetsType row_offsets;
+  RowBlockOffsetsType row_block_offsets;
+
+  int_type cost_per_row, num_blocks;
+
+  StaticCrsGraphMergePathFunctor(RowOffsetsType row_offsets_,
+                                 RowBlockOffsetsType row_block_offsets_,
+                                 int_type cost_per_row_, int_type num_blocks_)
+      : row_offsets(row_offsets_),
+        row_block_offsets(row_block_offsets_),
+        cost_per_row(cost_per_row_),
+        num_blocks(num_blocks_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t path_position(const int_type iRow) const {
+    return uint64_t(row_offsets(iRow)) + uint64_t(cost_per_row) * iRow;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int_type& iBlock) const {
+    const int_type num_rows = row_offsets.extent(0) - 1;
+    if (iBlock == 0) {
+      row_block_offsets(0) = 0;
+      return;
+    }
+    if (iBlock == num_blocks) {
+      row_block_offsets(num_blocks) = num_rows;
+      return;
+    }
+
+    const uint64_t diagonal = path_position(num_rows) * iBlock / num_blocks;
+
+    // First row whose path position is not below the diagonal.
+    int_type lo = 0, hi = num_rows;
+    while (lo < hi) {
+      const int_type mid = lo + (hi - lo) / 2;
+      if (path_position(mid) < diagonal)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    row_block_offsets(iBlock) = lo;
+  }
+};
 }  // namespace Impl
 
 /// \class GraphRowViewConst
@@ -409,6 +462,57 @@ class StaticCrsGraph {
 
     row_block_offsets = block_offsets;
   }
+
+  /**  \brief  Create a row partitioning into a given number of blocks
+   *           of equal work (non-zeros + a fixed cost per row) by
+   *           searching the merge path of each block boundary.
+   *
+   *  Every block receives the rows whose start falls into its share of
+   *  the total work, so a block exceeds the average work by at most the
+   *  cost of its last row.  Use row_block_policy() and row_block_range()
+   *  to iterate the resulting blocks.
+   */
+  void create_merge_path_partitioning(size_type num_blocks,
+                                      size_type fix_cost_per_row = 4) {
+    View<size_type*, array_layout, device_type> block_offsets(
+        "StaticCrsGraph::merge_path_offsets", num_blocks + 1);
+
+    Impl::StaticCrsGraphMergePathFunctor<
+        row_map_type, View<size_type*, array_layout, device_type> >
+        partitioner(row_map, block_offsets, fix_cost_per_row, num_blocks);
+
+    Kokkos::parallel_for(
+        "Kokkos::StaticCrsGraph::create_merge_path_partitioning",
+        Kokkos::RangePolicy<execution_space>(0, num_blocks + 1), partitioner);
+    typename device_type::execution_space().fence();
+
+    row_block_offsets = block_offsets;
+  }
+
+  /**  \brief  Return number of row blocks of the current partitioning
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_type numRowBlocks() const {
+    return (row_block_offsets.extent(0) != 0)
+               ? row_block_offsets.extent(0) - static_cast<size_type>(1)
+               : static_cast<size_type>(0);
+  }
+
+  /**  \brief  Range policy with one iteration per row block, for kernels
+   *           that process a balanced block of rows per work item.
+   */
+  Kokkos::RangePolicy<execution_space> row_block_policy() const {
+    return Kokkos::RangePolicy<execution_space>(0, numRowBlocks());
+  }
+
+  /**  \brief  Half-open range [first, second) of rows in a row block
+   */
+  KOKKOS_INLINE_FUNCTION
+  Kokkos::pair<size_type, size_type> row_block_range(
+      const size_type block) const {
+    return Kokkos::pair<size_type, size_type>(row_block_offsets(block),
+                                              row_block_offsets(block + 1));
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -422,6 +526,12 @@ typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
     const std::string& label,
     const std::vector<std::vector<InputSizeType> >& input);
 
+template <class StaticCrsGraphType, class RowsType, class ColsType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const size_t num_rows, const RowsType& rows,
+    const ColsType& cols, const bool sort_rows = true,
+    const bool remove_duplicates = false);
+
 //----------------------------------------------------------------------------
 
 template <class DataType, class Arg1Type, class Arg2Type, class Arg3Type,
@@ -53,6 +53,7 @@
 #include <climits>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 namespace Kokkos {
 namespace Impl {
@@ -71,14 +72,19 @@ struct BitsetCount {
   using size_type  = typename bitset_type::size_type;
   using value_type = size_type;
 
+  // Each work item counts a fixed-length run of blocks so the inner loop
+  // has a constant trip count and can be vectorized by the compiler.
+  enum : unsigned { chunk_blocks = 8u };
+
   bitset_type m_bitset;
 
   BitsetCount(bitset_type const& bitset) : m_bitset(bitset) {}
 
   size_type apply() const {
     size_type count = 0u;
+    const size_type nblocks = m_bitset.m_blocks.extent(0);
     parallel_reduce("Kokkos::Impl::BitsetCount::apply",
-                    m_bitset.m_blocks.extent(0), *this, count);
+                    (nblocks + chunk_blocks - 1u) / chunk_blocks, *this, count);
     return count;
   }
 
@@ -92,7 +98,158 @@ struct BitsetCount {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(size_type i, value_type& count) const {
-    count += bit_count(m_bitset.m_blocks[i]);
+    const size_type nblocks = m_bitset.m_blocks.extent(0);
+    const size_type begin   = i * chunk_blocks;
+    const auto* const blocks = m_bitset.m_blocks.data();
+    size_type local          = 0u;
+    if (begin + chunk_blocks <= nblocks) {
+      for (unsigned j = 0; j < chunk_blocks; ++j) {
+        local += bit_count(blocks[begin + j]);
+      }
+    } else {
+      for (size_type j = begin; j < nblocks; ++j) {
+        local += bit_count(blocks[j]);
+      }
+    }
+    count += local;
+  }
+};
+
+struct BitsetAnd {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a & b; }
+};
+
+struct BitsetOr {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a | b; }
+};
+
+struct BitsetXor {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a ^ b; }
+};
+
+struct BitsetAndNot {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a & ~b; }
+};
+
+/// dst = Op(dst, src) applied block-wise
+template <typename DstBitset, typename SrcBitset, typename Op>
+struct BitsetBinaryOp {
+  using execution_space =
+      typename DstBitset::execution_space::execution_space;
+  using size_type = typename DstBitset::size_type;
+
+  DstBitset m_dst;
+  SrcBitset m_src;
+
+  BitsetBinaryOp(DstBitset const& dst, SrcBitset const& src)
+      : m_dst(dst), m_src(src) {}
+
+  void apply() const {
+    if (m_dst.size() != m_src.size()) {
+      throw std::runtime_error(
+          "Error: Cannot combine bitsets of different sizes!");
+    }
+    parallel_for("Kokkos::Impl::BitsetBinaryOp::apply",
+                 m_dst.m_blocks.extent(0), *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    m_dst.m_blocks[i] = Op::apply(m_dst.m_blocks[i], m_src.m_blocks[i]);
+  }
+};
+
+/// index of the lowest bit set to 1, or size() if none is set
+template <typename Bitset>
+struct BitsetFindFirstSet {
+  using bitset_type = Bitset;
+  using execution_space =
+      typename bitset_type::execution_space::execution_space;
+  using size_type  = typename bitset_type::size_type;
+  using value_type = size_type;
+
+  enum : unsigned { block_size = sizeof(unsigned) * CHAR_BIT };
+
+  bitset_type m_bitset;
+
+  BitsetFindFirstSet(bitset_type const& bitset) : m_bitset(bitset) {}
+
+  size_type apply() const {
+    size_type first = m_bitset.size();
+    parallel_reduce("Kokkos::Impl::BitsetFindFirstSet::apply",
+                    m_bitset.m_blocks.extent(0), *this, first);
+    return first < m_bitset.size() ? first : m_bitset.size();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& first) const { first = ~value_type(0); }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& first,
+            const volatile value_type& other) const {
+    if (other < first) first = other;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& first) const {
+    const unsigned block = m_bitset.m_blocks[i];
+    if (block) {
+      const value_type bit = i * block_size + bit_scan_forward(block);
+      if (bit < first) first = bit;
+    }
+  }
+};
+
+/// writes the indices of all bits set to 1, in increasing order,
+/// to the front of a rank-1 view and returns how many bits are set;
+/// indices that do not fit in the view are dropped
+template <typename Bitset, typename IndexView>
+struct BitsetExtractSet {
+  using bitset_type = Bitset;
+  using execution_space =
+      typename bitset_type::execution_space::execution_space;
+  using size_type  = typename bitset_type::size_type;
+  using value_type = size_type;
+
+  enum : unsigned { block_size = sizeof(unsigned) * CHAR_BIT };
+
+  bitset_type m_bitset;
+  IndexView m_indices;
+
+  BitsetExtractSet(bitset_type const& bitset, IndexView const& indices)
+      : m_bitset(bitset), m_indices(indices) {}
+
+  size_type apply() const {
+    size_type count = 0u;
+    parallel_scan("Kokkos::Impl::BitsetExtractSet::apply",
+                  m_bitset.m_blocks.extent(0), *this, count);
+    return count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& count) const { count = 0u; }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& count, const volatile value_type& incr) const {
+    count += incr;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& offset, const bool final) const {
+    unsigned block = m_bitset.m_blocks[i];
+    if (final) {
+      const size_type extent = m_indices.extent(0);
+      size_type n            = offset;
+      while (block && n < extent) {
+        m_indices(n++) = i * block_size + bit_scan_forward(block);
+        block &= block - 1u;
+      }
+    }
+    offset += bit_count(m_bitset.m_blocks[i]);
   }
 };
 
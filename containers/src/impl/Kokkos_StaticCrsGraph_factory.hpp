@@ -207,6 +207,267 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
   return output;
 }
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+/// Histogram of a COO row index array into per-row counts.  Row indices
+/// outside of [0, num_rows) are counted as invalid instead of being written.
+template <class CountsType, class RowsType>
+struct StaticCrsGraphCooHistogram {
+  using size_type = typename CountsType::non_const_value_type;
+
+  CountsType counts;
+  RowsType rows;
+  size_t num_rows;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i, size_t& invalid) const {
+    const size_t r = static_cast<size_t>(rows(i));
+    if (r < num_rows) {
+      Kokkos::atomic_increment(&counts(r));
+    } else {
+      ++invalid;
+    }
+  }
+};
+
+/// Exclusive scan of per-row counts into a row map of length num_rows + 1.
+template <class CountsType, class RowMapType>
+struct StaticCrsGraphCooScan {
+  using size_type  = typename CountsType::non_const_value_type;
+  using value_type = size_type;
+
+  CountsType counts;
+  RowMapType row_map;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i, value_type& update, const bool final) const {
+    const size_type count = counts(i);
+    if (final) row_map(i) = update;
+    update += count;
+  }
+};
+
+/// Scatter of the COO column indices into their rows.  The order of the
+/// entries within a row is unspecified until the rows are sorted.
+template <class CursorType, class RowMapType, class EntriesType,
+          class RowsType, class ColsType>
+struct StaticCrsGraphCooScatter {
+  using size_type  = typename CursorType::non_const_value_type;
+  using entry_type = typename EntriesType::non_const_value_type;
+
+  CursorType cursor;
+  RowMapType row_map;
+  EntriesType entries;
+  RowsType rows;
+  ColsType cols;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    const size_t r = static_cast<size_t>(rows(i));
+    const size_type pos =
+        row_map(r) + Kokkos::atomic_fetch_add(&cursor(r), size_type(1));
+    entries(pos) = static_cast<entry_type>(cols(i));
+  }
+};
+
+/// In-place heap sort of the entries of each row.  Heap sort keeps the
+/// per-row work bounded for the occasional very long row without
+/// requiring scratch memory.
+template <class RowMapType, class EntriesType>
+struct StaticCrsGraphSortRows {
+  using size_type  = typename RowMapType::non_const_value_type;
+  using entry_type = typename EntriesType::non_const_value_type;
+
+  RowMapType row_map;
+  EntriesType entries;
+
+  KOKKOS_INLINE_FUNCTION
+  void sift_down(const size_type base, size_type root,
+                 const size_type n) const {
+    const entry_type value = entries(base + root);
+    size_type child;
+    while ((child = 2 * root + 1) < n) {
+      if (child + 1 < n && entries(base + child) < entries(base + child + 1))
+        ++child;
+      if (!(value < entries(base + child))) break;
+      entries(base + root) = entries(base + child);
+      root                 = child;
+    }
+    entries(base + root) = value;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    const size_type base = row_map(i);
+    const size_type n    = row_map(i + 1) - base;
+    if (n < 2) return;
+    for (size_type k = n / 2; k-- > 0;) sift_down(base, k, n);
+    for (size_type last = n - 1; last > 0; --last) {
+      const entry_type top  = entries(base);
+      entries(base)         = entries(base + last);
+      entries(base + last)  = top;
+      sift_down(base, 0, last);
+    }
+  }
+};
+
+/// Number of distinct entries of each (sorted) row.
+template <class CountsType, class RowMapType, class EntriesType>
+struct StaticCrsGraphCountUnique {
+  using size_type = typename CountsType::non_const_value_type;
+
+  CountsType counts;
+  RowMapType row_map;
+  EntriesType entries;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    const size_type begin = row_map(i);
+    const size_type end   = row_map(i + 1);
+    size_type count       = 0;
+    for (size_type k = begin; k < end; ++k) {
+      if (k == begin || entries(k) != entries(k - 1)) ++count;
+    }
+    counts(i) = count;
+  }
+};
+
+/// Copy of the distinct entries of each (sorted) row into the compacted
+/// entries array.
+template <class RowMapType, class EntriesType>
+struct StaticCrsGraphCompactRows {
+  using size_type = typename RowMapType::non_const_value_type;
+
+  RowMapType src_row_map;
+  EntriesType src_entries;
+  RowMapType dst_row_map;
+  EntriesType dst_entries;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    const size_type begin = src_row_map(i);
+    const size_type end   = src_row_map(i + 1);
+    size_type pos         = dst_row_map(i);
+    for (size_type k = begin; k < end; ++k) {
+      if (k == begin || src_entries(k) != src_entries(k - 1))
+        dst_entries(pos++) = src_entries(k);
+    }
+  }
+};
+
+}  // namespace Impl
+
+/// \brief Build a graph from an unsorted coordinate (COO) edge list.
+///
+/// Edge \c i connects row \c rows(i) to column \c cols(i).  The rows and
+/// cols Views must be accessible from the execution space of the graph.
+/// Construction runs in parallel end to end: a histogram of the row
+/// indices, a scan into the row map and a scatter of the column indices.
+/// If \c sort_rows is true the entries of each row are sorted in
+/// ascending order; if \c remove_duplicates is true repeated (row, col)
+/// pairs are stored once, which implies sorting.  Without sorting the
+/// order of entries within a row is unspecified.
+///
+/// Throws std::runtime_error if a row index is outside [0, num_rows).
+template <class StaticCrsGraphType, class RowsType, class ColsType>
+inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const size_t num_rows, const RowsType& rows,
+    const ColsType& cols, const bool sort_rows,
+    const bool remove_duplicates) {
+  using output_type     = StaticCrsGraphType;
+  using entries_type    = typename output_type::entries_type;
+  using execution_space = typename output_type::execution_space;
+  using size_type       = typename output_type::size_type;
+
+  static_assert(entries_type::rank == 1, "Graph entries view must be rank one");
+  static_assert(RowsType::rank == 1 && ColsType::rank == 1,
+                "COO row and column index views must be rank one");
+
+  using work_type = View<size_type*, typename output_type::array_layout,
+                         typename output_type::device_type>;
+  using policy_type = RangePolicy<execution_space>;
+
+  if (rows.extent(0) != cols.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::create_staticcrsgraph: COO row and column index views "
+        "differ in length");
+  }
+
+  const size_t num_edges = rows.extent(0);
+
+  work_type counts("Kokkos::StaticCrsGraph::coo_counts", num_rows + 1);
+  work_type row_map(label + "::row_map", num_rows + 1);
+
+  size_t invalid = 0;
+  Kokkos::parallel_reduce(
+      "Kokkos::create_staticcrsgraph::histogram",
+      policy_type(0, num_edges),
+      Impl::StaticCrsGraphCooHistogram<work_type, RowsType>{counts, rows,
+                                                            num_rows},
+      invalid);
+  if (invalid != 0) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::create_staticcrsgraph: COO row index out of range");
+  }
+
+  size_type num_entries = 0;
+  Kokkos::parallel_scan(
+      "Kokkos::create_staticcrsgraph::scan", policy_type(0, num_rows + 1),
+      Impl::StaticCrsGraphCooScan<work_type, work_type>{counts, row_map},
+      num_entries);
+
+  entries_type entries(label, num_entries);
+
+  // The counts are reused as per-row insertion cursors.
+  deep_copy(counts, size_type(0));
+  Kokkos::parallel_for(
+      "Kokkos::create_staticcrsgraph::scatter", policy_type(0, num_edges),
+      Impl::StaticCrsGraphCooScatter<work_type, work_type, entries_type,
+                                     RowsType, ColsType>{
+          counts, row_map, entries, rows, cols});
+
+  if (sort_rows || remove_duplicates) {
+    Kokkos::parallel_for(
+        "Kokkos::create_staticcrsgraph::sort", policy_type(0, num_rows),
+        Impl::StaticCrsGraphSortRows<work_type, entries_type>{row_map,
+                                                              entries});
+  }
+
+  if (remove_duplicates) {
+    Kokkos::parallel_for(
+        "Kokkos::create_staticcrsgraph::count_unique",
+        policy_type(0, num_rows),
+        Impl::StaticCrsGraphCountUnique<work_type, work_type, entries_type>{
+            counts, row_map, entries});
+
+    work_type unique_row_map(label + "::row_map", num_rows + 1);
+    size_type num_unique = 0;
+    Kokkos::parallel_scan(
+        "Kokkos::create_staticcrsgraph::scan_unique",
+        policy_type(0, num_rows + 1),
+        Impl::StaticCrsGraphCooScan<work_type, work_type>{counts,
+                                                          unique_row_map},
+        num_unique);
+
+    if (num_unique != num_entries) {
+      entries_type unique_entries(label, num_unique);
+      Kokkos::parallel_for(
+          "Kokkos::create_staticcrsgraph::compact", policy_type(0, num_rows),
+          Impl::StaticCrsGraphCompactRows<work_type, entries_type>{
+              row_map, entries, unique_row_map, unique_entries});
+      entries = unique_entries;
+    }
+    row_map = unique_row_map;
+  }
+
+  output_type output;
+  output.entries = entries;
+  output.row_map = row_map;
+  return output;
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
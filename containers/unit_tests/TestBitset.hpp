@@ -268,7 +268,89 @@ void test_bitset() {
   }
 }
 
+template <typename Device>
+void test_bitset_set_algebra() {
+  using bitset_type      = Kokkos::Bitset<Device>;
+  using host_bitset_type = Kokkos::Bitset<Kokkos::DefaultHostExecutionSpace>;
+  using index_view       = Kokkos::View<unsigned*, Device>;
+
+  const unsigned size = 1000u;  // not a multiple of the block size
+
+  host_bitset_type ha(size), hb(size);
+  for (unsigned i = 0; i < size; ++i) {
+    if (i % 3 == 0) ha.set(i);
+    if (i % 5 == 0) hb.set(i);
+  }
+
+  bitset_type a(size), b(size), c(size);
+  Kokkos::deep_copy(a, ha);
+  Kokkos::deep_copy(b, hb);
+
+  auto check = [&](bitset_type const& d, bool (*pred)(unsigned)) {
+    host_bitset_type h(size);
+    Kokkos::deep_copy(h, d);
+    unsigned expected = 0u;
+    unsigned first    = size;
+    for (unsigned i = 0; i < size; ++i) {
+      EXPECT_EQ(pred(i), h.test(i)) << "bit " << i;
+      if (pred(i)) {
+        ++expected;
+        if (first == size) first = i;
+      }
+    }
+    EXPECT_EQ(expected, d.count());
+    EXPECT_EQ(first, d.find_first_set());
+
+    index_view indices("indices", size);
+    EXPECT_EQ(expected, d.extract_set(indices));
+    auto h_indices = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         indices);
+    for (unsigned i = 0, n = 0; i < size; ++i) {
+      if (pred(i)) {
+        EXPECT_EQ(i, h_indices(n++));
+      }
+    }
+  };
+
+  Kokkos::deep_copy(c, a);
+  c.bitwise_and(b);
+  check(c, [](unsigned i) { return i % 3 == 0 && i % 5 == 0; });
+
+  Kokkos::deep_copy(c, a);
+  c.bitwise_or(b);
+  check(c, [](unsigned i) { return i % 3 == 0 || i % 5 == 0; });
+
+  Kokkos::deep_copy(c, a);
+  c.bitwise_xor(b);
+  check(c, [](unsigned i) { return (i % 3 == 0) != (i % 5 == 0); });
+
+  Kokkos::deep_copy(c, a);
+  c.bitwise_andnot(b);
+  check(c, [](unsigned i) { return i % 3 == 0 && i % 5 != 0; });
+
+  // an empty set has no first bit and no indices
+  c.reset();
+  EXPECT_EQ(size, c.find_first_set());
+  EXPECT_EQ(0u, c.extract_set(index_view("indices", size)));
+
+  // a short view receives the leading indices only
+  {
+    index_view indices("indices", 4);
+    EXPECT_EQ(a.count(), a.extract_set(indices));
+    auto h_indices = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         indices);
+    for (unsigned n = 0; n < 4; ++n) EXPECT_EQ(3 * n, h_indices(n));
+  }
+
+  bitset_type wrong_size(size + 1);
+  ASSERT_THROW(c.bitwise_or(wrong_size), std::runtime_error);
+}
+
 TEST(TEST_CATEGORY, bitset) { test_bitset<TEST_EXECSPACE>(); }
+
+TEST(TEST_CATEGORY, bitset_set_algebra) {
+  test_bitset_set_algebra<TEST_EXECSPACE>();
+}
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_BITSET_HPP
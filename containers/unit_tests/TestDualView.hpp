@@ -375,6 +375,92 @@ struct test_dualview_realloc {
   }
 };
 
+inline uint64_t& dirty_tracking_copied_bytes() {
+  static uint64_t bytes = 0;
+  return bytes;
+}
+
+inline void dirty_tracking_begin_deep_copy(Kokkos::Tools::SpaceHandle,
+                                           const char*, const void*,
+                                           Kokkos::Tools::SpaceHandle,
+                                           const char*, const void*,
+                                           uint64_t size) {
+  dirty_tracking_copied_bytes() += size;
+}
+
+template <typename Scalar, class Device>
+struct test_dualview_dirty_tracking {
+  using scalar_type = Scalar;
+
+  template <typename ViewType>
+  void run_me() {
+    const unsigned int n = 100;
+    const unsigned int m = 4;
+    const size_t row_bytes = m * sizeof(scalar_type);
+
+    // Separate allocations so host and device never alias.
+    typename ViewType::t_dev d("D", n, m);
+    typename ViewType::t_host h = Kokkos::create_mirror(d);
+    ViewType a(d, h);
+    a.enable_dirty_tracking(8);
+    ASSERT_TRUE(a.dirty_tracking_enabled());
+
+    auto check_equal = [&]() {
+      auto d_copy =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a.d_view);
+      for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < m; ++j) ASSERT_EQ(a.h_view(i, j), d_copy(i, j));
+    };
+
+    Kokkos::Tools::Experimental::set_begin_deep_copy_callback(
+        dirty_tracking_begin_deep_copy);
+
+    // A plain modify marks every row.
+    Kokkos::deep_copy(a.h_view, 1);
+    a.modify_host();
+    dirty_tracking_copied_bytes() = 0;
+    a.sync_device();
+    ASSERT_EQ(dirty_tracking_copied_bytes(), n * row_bytes);
+    check_equal();
+
+    // Rows 10-12 and 90 sit in blocks [8, 16) and [88, 96).
+    for (size_t j = 0; j < m; ++j) {
+      for (size_t i = 10; i < 13; ++i) a.h_view(i, j) = 2;
+      a.h_view(90, j) = 3;
+    }
+    a.modify_host(10, 13);
+    a.modify_host(90, 91);
+    dirty_tracking_copied_bytes() = 0;
+    a.sync_device();
+    ASSERT_EQ(dirty_tracking_copied_bytes(), 16 * row_bytes);
+    check_equal();
+    ASSERT_FALSE(a.need_sync_device());
+
+    // The last block is partial: rows [96, 100).
+    Kokkos::deep_copy(Kokkos::subview(a.d_view, 99, Kokkos::ALL), 4);
+    a.modify_device(99, 100);
+    dirty_tracking_copied_bytes() = 0;
+    a.sync_host();
+    ASSERT_EQ(dirty_tracking_copied_bytes(), 4 * row_bytes);
+    check_equal();
+
+    // Nothing modified, nothing moved.
+    dirty_tracking_copied_bytes() = 0;
+    a.sync_host();
+    a.sync_device();
+    ASSERT_EQ(dirty_tracking_copied_bytes(), 0u);
+
+    Kokkos::Tools::Experimental::set_begin_deep_copy_callback(nullptr);
+
+    a.disable_dirty_tracking();
+    ASSERT_FALSE(a.dirty_tracking_enabled());
+  }
+
+  test_dualview_dirty_tracking() {
+    run_me<Kokkos::DualView<Scalar**, Kokkos::LayoutRight, Device> >();
+  }
+};
+
 }  // namespace Impl
 
 template <typename Scalar, typename Device>
@@ -404,6 +490,11 @@ void test_dualview_resize() {
   Impl::test_dualview_resize<Scalar, Device>();
 }
 
+template <typename Scalar, typename Device>
+void test_dualview_dirty_tracking() {
+  Impl::test_dualview_dirty_tracking<Scalar, Device>();
+}
+
 // FIXME_SYCL requires MDRange policy
 #ifndef KOKKOS_ENABLE_SYCL
 TEST(TEST_CATEGORY, dualview_combination) {
@@ -433,6 +524,11 @@ TEST(TEST_CATEGORY, dualview_realloc) {
 TEST(TEST_CATEGORY, dualview_resize) {
   test_dualview_resize<int, TEST_EXECSPACE>();
 }
+
+TEST(TEST_CATEGORY, dualview_dirty_tracking) {
+  test_dualview_dirty_tracking<int, TEST_EXECSPACE>();
+  test_dualview_dirty_tracking<double, TEST_EXECSPACE>();
+}
 #endif
 
 }  // namespace Test
@@ -717,6 +717,7 @@ class TestDynViewAPI {
     run_test_subview();
     run_test_subview_strided();
     run_test_vector();
+    run_test_static_rank();
   }
 
   static void run_operator_test_rank12345() {
@@ -750,6 +751,56 @@ class TestDynViewAPI {
     ASSERT_EQ(drv0.extent(2), 1);
   }
 
+  static void run_test_static_rank() {
+    using view_type = Kokkos::DynRankView<int, host_drv_space>;
+
+    view_type a("a", 3, 4);
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 4; ++j) a(i, j) = 10 * i + j;
+
+    int static_rank = -1;
+    Kokkos::dispatch_static_rank(a, [&](const auto& v) {
+      using static_type = typename std::decay<decltype(v)>::type;
+      static_rank       = static_type::Rank;
+    });
+    ASSERT_EQ(static_rank, 2);
+
+    auto a2 = Kokkos::as_view_of_rank<2>(a);
+    ASSERT_EQ(a2.data(), a.data());
+    ASSERT_EQ(a2.use_count(), a.use_count());
+    ASSERT_EQ(a2.extent(0), 3u);
+    ASSERT_EQ(a2.extent(1), 4u);
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 4; ++j) ASSERT_EQ(a2(i, j), a(i, j));
+    ASSERT_THROW(Kokkos::as_view_of_rank<3>(a), std::runtime_error);
+
+    view_type s("s");
+    s() = 7;
+    Kokkos::dispatch_static_rank(s, [&](const auto& v) {
+      static_rank = std::decay<decltype(v)>::type::Rank;
+      ASSERT_EQ(*v.data(), 7);
+    });
+    ASSERT_EQ(static_rank, 0);
+
+    // Strided subviews keep their strides at static rank.
+    auto col = Kokkos::subdynrankview(a, Kokkos::ALL(), 2);
+    Kokkos::dispatch_static_rank(col, [&](const auto& v) {
+      static_rank = std::decay<decltype(v)>::type::Rank;
+      ASSERT_EQ(v.extent(0), 3u);
+      for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(v.data()[i * v.stride_0()], 10 * i + 2);
+      }
+    });
+    ASSERT_EQ(static_rank, 1);
+
+    view_type b("b", 2, 1, 2, 1, 2, 1, 2);
+    Kokkos::dispatch_static_rank(b, [&](const auto& v) {
+      static_rank = std::decay<decltype(v)>::type::Rank;
+      ASSERT_EQ(v.size(), b.size());
+    });
+    ASSERT_EQ(static_rank, 7);
+  }
+
   static void run_test_mirror() {
     using view_type   = Kokkos::DynRankView<int, host_drv_space>;
     using mirror_type = typename view_type::HostMirror;
@@ -241,6 +241,137 @@ struct TestDynamicView {
 #endif
     }  // end scope
   }
+
+  static void run_pool(unsigned arg_total_size) {
+    using pool_type = typename view_type::memory_pool;
+
+    // Test: Create DynamicView allocating chunks from a memory pool,
+    // resize in bulk, grow within a parallel region, and check values
+    // through chunk-local iteration
+    pool_type pool(memory_space(), 4 * arg_total_size * sizeof(Scalar),
+                   1024 * sizeof(Scalar), 1024 * sizeof(Scalar));
+    {
+      view_type da("da", 1024, arg_total_size, pool);
+      ASSERT_EQ(da.size(), 0);
+
+      unsigned da_size = arg_total_size / 8;
+      da.resize_parallel(da_size);
+      ASSERT_EQ(da.size(), da_size);
+      ASSERT_EQ(da.chunk_count(), (da_size + 1023) / 1024);
+
+#if defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+      unsigned da_grow = arg_total_size / 2;
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<execution_space>(0, da_grow),
+          KOKKOS_LAMBDA(const int i) {
+            da.grow(i + 1);
+            da(i) = Scalar(i);
+          });
+      ASSERT_EQ(da.size(), da_grow);
+
+      value_type result_sum = 0.0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<execution_space>(0, da.chunk_count()),
+          KOKKOS_LAMBDA(const int ic, value_type& partial_sum) {
+            const Scalar* const chunk = da.chunk_data(ic);
+            const size_t n            = da.chunk_extent(ic);
+            for (size_t i = 0; i < n; ++i) partial_sum += (value_type)chunk[i];
+          },
+          result_sum);
+
+      ASSERT_EQ(result_sum, (value_type)(da_grow * (da_grow - 1) / 2));
+#endif
+
+      // shrink back, releasing chunks to the pool
+      da.resize_parallel(da_size);
+      ASSERT_EQ(da.size(), da_size);
+    }  // end scope
+
+    // all chunks were returned to the pool
+    typename pool_type::usage_statistics stats;
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(stats.consumed_blocks, 0u);
+  }
+
+  static void run_pool_partial_chunk() {
+    using pool_type = typename view_type::memory_pool;
+
+    // Test: Grow a pool-backed DynamicView into the middle of a chunk,
+    // shrink it into the middle of an earlier chunk and grow it again;
+    // each resize must take (or return) exactly the chunks it covers and
+    // the entries kept by the shrink must be unchanged
+    const unsigned chunk = 1024;
+    pool_type pool(memory_space(), 16 * chunk * sizeof(Scalar),
+                   chunk * sizeof(Scalar), chunk * sizeof(Scalar));
+    typename pool_type::usage_statistics stats;
+
+    view_type da("da", chunk, 8 * chunk, pool);
+
+    const unsigned grow_size   = 2 * chunk + chunk / 2;
+    const unsigned shrink_size = chunk + chunk / 4;
+
+    da.resize_serial(grow_size);
+    ASSERT_EQ(da.size(), grow_size);
+    ASSERT_EQ(da.chunk_count(), 3u);
+    ASSERT_EQ(da.chunk_extent(2), chunk / 2);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(stats.consumed_blocks, 3u);
+
+#if defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, grow_size),
+        KOKKOS_LAMBDA(const int i) { da(i) = Scalar(i); });
+#endif
+
+    // shrink back into the second chunk, releasing the third to the pool
+    da.resize_serial(shrink_size);
+    ASSERT_EQ(da.size(), shrink_size);
+    ASSERT_EQ(da.chunk_count(), 2u);
+    ASSERT_EQ(da.chunk_extent(1), chunk / 4);
+    ASSERT_EQ(da.chunk_extent(2), 0u);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(stats.consumed_blocks, 2u);
+
+#if defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+    value_type result_sum = 0.0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space>(0, da.chunk_count()),
+        KOKKOS_LAMBDA(const int ic, value_type& partial_sum) {
+          const Scalar* const data = da.chunk_data(ic);
+          const size_t n           = da.chunk_extent(ic);
+          for (size_t i = 0; i < n; ++i) partial_sum += (value_type)data[i];
+        },
+        result_sum);
+    ASSERT_EQ(result_sum, (value_type)(shrink_size * (shrink_size - 1) / 2));
+#endif
+
+    // grow into the middle of the third chunk again, which takes one
+    // chunk back from the pool
+    da.resize_serial(grow_size);
+    ASSERT_EQ(da.chunk_count(), 3u);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(stats.consumed_blocks, 3u);
+
+#if defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(shrink_size, grow_size),
+        KOKKOS_LAMBDA(const int i) { da(i) = Scalar(i); });
+
+    result_sum = 0.0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space>(0, grow_size),
+        KOKKOS_LAMBDA(const int i, value_type& partial_sum) {
+          partial_sum += (value_type)da(i);
+        },
+        result_sum);
+    ASSERT_EQ(result_sum, (value_type)(grow_size * (grow_size - 1) / 2));
+#endif
+
+    da.resize_serial(0);
+    ASSERT_EQ(da.chunk_count(), 0u);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(stats.consumed_blocks, 0u);
+  }
 };
 
 // FIXME_SYCL needs resize_serial
@@ -252,6 +383,20 @@ TEST(TEST_CATEGORY, dynamic_view) {
     TestDynView::run(100000 + 100 * i);
   }
 }
+
+TEST(TEST_CATEGORY, dynamic_view_pool) {
+  using TestDynView = TestDynamicView<double, TEST_EXECSPACE>;
+
+  for (int i = 0; i < 4; ++i) {
+    TestDynView::run_pool(100000 + 100 * i);
+  }
+}
+
+TEST(TEST_CATEGORY, dynamic_view_pool_partial_chunk) {
+  using TestDynView = TestDynamicView<double, TEST_EXECSPACE>;
+
+  TestDynView::run_pool_partial_chunk();
+}
 #endif
 
 }  // namespace Test
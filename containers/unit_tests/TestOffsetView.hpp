@@ -699,6 +699,64 @@ void test_offsetview_offsets_rank3() {
 
   ASSERT_EQ(0, errors);
 }
+
+template <typename DEVICE>
+void test_offsetview_policies() {
+  using offset_view_type =
+      Kokkos::Experimental::OffsetView<int**, Kokkos::LayoutLeft, DEVICE>;
+  using offset_view_1d_type = Kokkos::Experimental::OffsetView<int*, DEVICE>;
+
+  offset_view_type ov("ov", {-2, 5}, {1, 9});
+  offset_view_type copy("copy", {-2, 5}, {1, 9});
+  auto v = ov.view();
+
+  // The index space policy covers [begin + halo, end - halo).
+  auto policy = Kokkos::Experimental::index_space_policy(ov, 1);
+  ASSERT_EQ(policy.m_lower[0], -1);
+  ASSERT_EQ(policy.m_upper[0], 5);
+  ASSERT_EQ(policy.m_lower[1], 2);
+  ASSERT_EQ(policy.m_upper[1], 9);
+
+  Kokkos::deep_copy(ov, -1);
+  Kokkos::parallel_for(
+      "OffsetViewIndexSpace", Kokkos::Experimental::index_space_policy(ov),
+      KOKKOS_LAMBDA(const int64_t i, const int64_t j) {
+        ov(i, j) = element({int(i + 2), int(j - 1)});
+      });
+
+  // The zero-based policy addresses the underlying View directly.
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      "OffsetViewZeroBased", Kokkos::Experimental::zero_based_policy(ov, 1),
+      KOKKOS_LAMBDA(const int64_t i, const int64_t j, int& lerrors) {
+        lerrors += (v(i, j) != element({int(i), int(j)}));
+      },
+      errors);
+  ASSERT_EQ(0, errors);
+
+  typename DEVICE::execution_space space;
+  Kokkos::deep_copy(space, copy, ov);
+  space.fence();
+  auto h_copy = Kokkos::create_mirror_view(copy.view());
+  Kokkos::deep_copy(h_copy, copy.view());
+  for (int i = 0; i < int(h_copy.extent(0)); ++i) {
+    for (int j = 0; j < int(h_copy.extent(1)); ++j) {
+      ASSERT_EQ(h_copy(i, j), element({i, j}));
+    }
+  }
+
+  offset_view_1d_type ov1("ov1", {-4, 4});
+  auto policy1 = Kokkos::Experimental::index_space_policy(ov1, 2);
+  ASSERT_EQ(policy1.begin(), -2);
+  ASSERT_EQ(policy1.end(), 3);
+  Kokkos::deep_copy(space, ov1, 7);
+  space.fence();
+  int sum = 0;
+  Kokkos::parallel_reduce(
+      "OffsetViewRange", Kokkos::Experimental::index_space_policy(ov1),
+      KOKKOS_LAMBDA(const int64_t i, int& lsum) { lsum += ov1(i); }, sum);
+  ASSERT_EQ(sum, 7 * 9);
+}
 #endif
 
 // FIXME_SYCL needs MDRangePolicy
@@ -728,6 +786,12 @@ TEST(TEST_CATEGORY, offsetview_offsets_rank2) {
 TEST(TEST_CATEGORY, offsetview_offsets_rank3) {
   test_offsetview_offsets_rank3<TEST_EXECSPACE>();
 }
+
+#ifndef KOKKOS_ENABLE_SYCL
+TEST(TEST_CATEGORY, offsetview_policies) {
+  test_offsetview_policies<TEST_EXECSPACE>();
+}
+#endif
 #endif
 
 }  // namespace Test
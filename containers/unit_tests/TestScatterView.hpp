@@ -560,6 +560,26 @@ struct TestDuplicatedScatterView {
         Kokkos::Experimental::ScatterNonAtomic, ScatterType, NumberType>
         test_sv_left_config;
     test_sv_left_config.run_test(n);
+    // tracked duplication
+    test_scatter_view_config<DeviceType, Kokkos::LayoutRight,
+                             Kokkos::Experimental::ScatterDuplicatedTracked,
+                             Kokkos::Experimental::ScatterNonAtomic,
+                             ScatterType, NumberType>
+        test_sv_tracked_right_config;
+    test_sv_tracked_right_config.run_test(n);
+    test_scatter_view_config<DeviceType, Kokkos::LayoutLeft,
+                             Kokkos::Experimental::ScatterDuplicatedTracked,
+                             Kokkos::Experimental::ScatterNonAtomic,
+                             ScatterType, NumberType>
+        test_sv_tracked_left_config;
+    test_sv_tracked_left_config.run_test(n);
+    // hybrid cached/atomic contribution
+    test_scatter_view_config<DeviceType, Kokkos::LayoutRight,
+                             Kokkos::Experimental::ScatterHybrid,
+                             Kokkos::Experimental::ScatterAtomic, ScatterType,
+                             NumberType>
+        test_sv_hybrid_config;
+    test_sv_hybrid_config.run_test(n);
   }
 };
 
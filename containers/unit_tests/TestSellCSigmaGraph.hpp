@@ -0,0 +1,176 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SellCSigmaGraph.hpp>
+
+namespace Test {
+namespace TestSellCSigmaGraph {
+
+template <class Space>
+void run_test_sell(const unsigned num_rows, const unsigned chunk_size,
+                   const unsigned sigma) {
+  using crs_type  = Kokkos::StaticCrsGraph<int, Space>;
+  using sell_type = Kokkos::Experimental::SellCSigmaGraph<int, Space>;
+  using size_type = typename sell_type::size_type;
+
+  std::vector<std::vector<int> > graph(num_rows);
+  for (unsigned i = 0; i < num_rows; ++i) {
+    // Irregular row lengths, including empty rows.
+    const unsigned length = (i * 7) % 13 + ((i % 17 == 0) ? 40 : 0);
+    for (unsigned j = 0; j < length; ++j) {
+      graph[i].push_back((i + j * 5) % num_rows);
+    }
+  }
+
+  crs_type crs   = Kokkos::create_staticcrsgraph<crs_type>("crs", graph);
+  sell_type sell = Kokkos::Experimental::create_sell_c_sigma_graph<sell_type>(
+      "sell", crs, chunk_size, sigma);
+
+  const size_type C = chunk_size ? chunk_size : sell_type::default_chunk_size();
+  ASSERT_EQ(sell.numRows(), num_rows);
+  ASSERT_EQ(sell.chunkSize(), C);
+  ASSERT_EQ(sell.sigma() % C, 0u);
+  ASSERT_EQ(sell.numChunks(), (num_rows + C - 1) / C);
+  ASSERT_EQ(sell.chunk_policy().end(), sell.numChunks());
+  ASSERT_EQ(sell.team_policy().league_size(), int(sell.numChunks()));
+
+  auto offsets     = Kokkos::create_mirror_view(sell.chunk_offsets);
+  auto slot_rows   = Kokkos::create_mirror_view(sell.slot_rows);
+  auto row_lengths = Kokkos::create_mirror_view(sell.row_lengths);
+  auto entries     = Kokkos::create_mirror_view(sell.entries);
+  Kokkos::deep_copy(offsets, sell.chunk_offsets);
+  Kokkos::deep_copy(slot_rows, sell.slot_rows);
+  Kokkos::deep_copy(row_lengths, sell.row_lengths);
+  Kokkos::deep_copy(entries, sell.entries);
+
+  std::vector<int> seen(num_rows, 0);
+  for (size_type k = 0; k < sell.numChunks(); ++k) {
+    const size_type width = (offsets(k + 1) - offsets(k)) / C;
+    size_type max_length  = 0;
+    for (size_type lane = 0; lane < C; ++lane) {
+      const size_type slot = k * C + lane;
+      const size_type row  = slot_rows(slot);
+      if (row == num_rows) {
+        ASSERT_EQ(row_lengths(slot), 0u);
+        continue;
+      }
+      ASSERT_LT(row, num_rows);
+      // Rows never leave their sigma window.
+      ASSERT_EQ(row / sell.sigma(), slot / sell.sigma());
+      ++seen[row];
+      ASSERT_EQ(row_lengths(slot), graph[row].size());
+      max_length = std::max<size_type>(max_length, row_lengths(slot));
+      for (size_type j = 0; j < row_lengths(slot); ++j) {
+        ASSERT_EQ(entries(offsets(k) + j * C + lane), graph[row][j]);
+      }
+      // Within a window rows are sorted by decreasing length.
+      if (slot % sell.sigma() != 0 && slot_rows(slot - 1) != num_rows) {
+        ASSERT_GE(row_lengths(slot - 1), row_lengths(slot));
+      }
+    }
+    ASSERT_EQ(width, max_length);
+  }
+  for (unsigned i = 0; i < num_rows; ++i) ASSERT_EQ(seen[i], 1);
+
+  // SpMV with the CRS graph and with the SELL-C-sigma layout agree.
+  Kokkos::View<double*, Space> crs_values("crs_values", crs.entries.extent(0));
+  Kokkos::View<double*, Space> sell_values("sell_values",
+                                           sell.entries.extent(0));
+  Kokkos::View<double*, Space> x("x", num_rows), y_crs("y_crs", num_rows),
+      y_sell("y_sell", num_rows);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Space>(0, crs.entries.extent(0)),
+      KOKKOS_LAMBDA(const int i) { crs_values(i) = 1.0 + i % 3; });
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Space>(0, num_rows),
+      KOKKOS_LAMBDA(const int i) { x(i) = 0.5 * i; });
+  Kokkos::Experimental::fill_sell_c_sigma_values(sell, crs, crs_values,
+                                                 sell_values);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Space>(0, num_rows), KOKKOS_LAMBDA(const int i) {
+        double sum = 0;
+        for (auto j = crs.row_map(i); j < crs.row_map(i + 1); ++j)
+          sum += crs_values(j) * x(crs.entries(j));
+        y_crs(i) = sum;
+      });
+  Kokkos::parallel_for(
+      sell.chunk_policy(), KOKKOS_LAMBDA(const size_type k) {
+        const size_type width = sell.chunk_width(k);
+        for (size_type lane = 0; lane < sell.chunkSize(); ++lane) {
+          const size_type row = sell.slot_row(k, lane);
+          if (row == sell.numRows()) continue;
+          double sum = 0;
+          for (size_type j = 0; j < width; ++j) {
+            const size_type idx =
+                sell.chunk_offsets(k) + j * sell.chunkSize() + lane;
+            sum += sell_values(idx) * x(sell.entries(idx));
+          }
+          y_sell(row) = sum;
+        }
+      });
+
+  auto h_crs  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_crs);
+  auto h_sell =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_sell);
+  for (unsigned i = 0; i < num_rows; ++i) ASSERT_EQ(h_crs(i), h_sell(i));
+}
+
+}  // namespace TestSellCSigmaGraph
+
+TEST(TEST_CATEGORY, sell_c_sigma_graph) {
+  TestSellCSigmaGraph::run_test_sell<TEST_EXECSPACE>(0, 4, 16);
+  TestSellCSigmaGraph::run_test_sell<TEST_EXECSPACE>(1, 4, 16);
+  TestSellCSigmaGraph::run_test_sell<TEST_EXECSPACE>(1000, 4, 16);
+  TestSellCSigmaGraph::run_test_sell<TEST_EXECSPACE>(1003, 8, 13);
+  TestSellCSigmaGraph::run_test_sell<TEST_EXECSPACE>(5000, 0, 0);
+}
+
+}  // namespace Test
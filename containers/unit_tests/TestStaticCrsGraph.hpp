@@ -44,6 +44,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <vector>
 
 #include <Kokkos_StaticCrsGraph.hpp>
@@ -209,6 +210,60 @@ void run_test_graph3(size_t B, size_t N) {
   }
 }
 
+template <class Space>
+void run_test_graph_merge_path(size_t B, size_t N) {
+  srand(10310);
+
+  using dView = Kokkos::StaticCrsGraph<int, Space>;
+  using hView = typename dView::HostMirror;
+
+  const unsigned LENGTH = 2000;
+
+  std::vector<size_t> sizes(LENGTH);
+
+  for (size_t i = 0; i < LENGTH; ++i) {
+    sizes[i] = rand() % 1000;
+  }
+
+  sizes[1]    = N;
+  sizes[1998] = N;
+
+  const size_t C = 1;
+  dView dx       = Kokkos::create_staticcrsgraph<dView>("test", sizes);
+  dx.create_merge_path_partitioning(B, C);
+  hView hx = Kokkos::create_mirror(dx);
+
+  ASSERT_EQ(dx.numRowBlocks(), B);
+  ASSERT_EQ(hx.row_block_offsets(0), 0u);
+  ASSERT_EQ(hx.row_block_offsets(B), hx.numRows());
+
+  const size_t total = hx.row_map(hx.numRows()) + C * hx.numRows();
+  for (size_t i = 0; i < B; i++) {
+    const auto range = hx.row_block_range(i);
+    ASSERT_LE(range.first, range.second);
+    if (range.first == range.second) continue;
+
+    size_t ne = 0;
+    for (auto j = range.first; j < range.second; j++)
+      ne += hx.row_map(j + 1) - hx.row_map(j) + C;
+
+    // At most one row beyond the average work per block.
+    const size_t last = range.second - 1;
+    ASSERT_LE(ne, total / B + 1 + hx.row_map(last + 1) - hx.row_map(last) + C);
+  }
+
+  // The block policy visits every entry exactly once.
+  size_t visited = 0;
+  Kokkos::parallel_reduce(
+      dx.row_block_policy(),
+      KOKKOS_LAMBDA(const size_t block, size_t& count) {
+        const auto range = dx.row_block_range(block);
+        count += dx.row_map(range.second) - dx.row_map(range.first);
+      },
+      visited);
+  ASSERT_EQ(visited, (size_t)hx.row_map(hx.numRows()));
+}
+
 template <class Space>
 void run_test_graph4() {
   using ordinal_type       = unsigned int;
@@ -281,6 +336,65 @@ void run_test_graph4() {
                             Kokkos::MemoryUnmanaged>::value));
 }
 
+template <class Space>
+void run_test_graph_coo(const bool sort_rows, const bool remove_duplicates) {
+  using dView = Kokkos::StaticCrsGraph<int, Space>;
+  using hView = typename dView::HostMirror;
+  using index_view = Kokkos::View<int*, Space>;
+
+  const int num_rows  = 500;
+  const int num_edges = 20000;
+
+  srand(4711);
+
+  index_view rows("rows", num_edges);
+  index_view cols("cols", num_edges);
+  auto h_rows = Kokkos::create_mirror_view(rows);
+  auto h_cols = Kokkos::create_mirror_view(cols);
+
+  // Skewed rows and a narrow column range so that duplicates are common.
+  std::vector<std::vector<int> > expected(num_rows);
+  for (int i = 0; i < num_edges; ++i) {
+    const int r = (i % 7 == 0) ? 3 : rand() % num_rows;
+    const int c = rand() % 64;
+    h_rows(i)   = r;
+    h_cols(i)   = c;
+    expected[r].push_back(c);
+  }
+  Kokkos::deep_copy(rows, h_rows);
+  Kokkos::deep_copy(cols, h_cols);
+
+  for (auto& row : expected) {
+    std::sort(row.begin(), row.end());
+    if (remove_duplicates) {
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+    }
+  }
+
+  dView dx = Kokkos::create_staticcrsgraph<dView>(
+      "coo", num_rows, rows, cols, sort_rows, remove_duplicates);
+  hView hx = Kokkos::create_mirror(dx);
+
+  ASSERT_EQ(hx.numRows(), (unsigned)num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    const size_t begin = hx.row_map(i);
+    const size_t n     = hx.row_map(i + 1) - begin;
+    ASSERT_EQ(n, expected[i].size());
+    std::vector<int> row(hx.entries.data() + begin,
+                         hx.entries.data() + begin + n);
+    if (!sort_rows && !remove_duplicates) std::sort(row.begin(), row.end());
+    ASSERT_EQ(row, expected[i]);
+  }
+  ASSERT_EQ((size_t)hx.row_map(num_rows), (size_t)hx.entries.extent(0));
+
+  // Row indices outside of the graph are rejected.
+  h_rows(num_edges / 2) = num_rows;
+  Kokkos::deep_copy(rows, h_rows);
+  ASSERT_THROW(
+      Kokkos::create_staticcrsgraph<dView>("coo", num_rows, rows, cols),
+      std::runtime_error);
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -303,4 +417,18 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
 }
+
+TEST(TEST_CATEGORY, staticcrsgraph_merge_path_partitioning) {
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(1, 0);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(3, 100000);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(75, 1000);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(75, 100000);
+  TestStaticCrsGraph::run_test_graph_merge_path<TEST_EXECSPACE>(4000, 10000);
+}
+
+TEST(TEST_CATEGORY, staticcrsgraph_from_coo) {
+  TestStaticCrsGraph::run_test_graph_coo<TEST_EXECSPACE>(false, false);
+  TestStaticCrsGraph::run_test_graph_coo<TEST_EXECSPACE>(true, false);
+  TestStaticCrsGraph::run_test_graph_coo<TEST_EXECSPACE>(true, true);
+}
 }  // namespace Test
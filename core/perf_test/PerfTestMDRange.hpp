@@ -104,7 +104,9 @@ struct MultiDimRangePerf3D {
                                  const unsigned int Ti = 1,
                                  const unsigned int Tj = 1,
                                  const unsigned int Tk = 1,
-                                 const long iter       = 1) {
+                                 const long iter       = 1,
+                                 const Kokkos::TileOrder order =
+                                     Kokkos::TileOrder::Lexicographic) {
     // This test performs multidim range over all dims
     view_type Atest("Atest", icount, jcount, kcount);
     view_type Btest("Btest", icount + 2, jcount + 2, kcount + 2);
@@ -136,6 +138,7 @@ struct MultiDimRangePerf3D {
           execution_space>
           policy(point_type{{0, 0, 0}}, point_type{{icount, jcount, kcount}},
                  tile_type{{Ti, Tj, Tk}});
+      policy.set_tile_order(order);
 
       Kokkos::parallel_for(policy_initA, Init(Atest, icount, jcount, kcount));
       execution_space().fence();
@@ -228,6 +231,7 @@ struct MultiDimRangePerf3D {
           Kokkos::Rank<3, iterate_type::Left, iterate_type::Left>,
           execution_space>
           policy({{0, 0, 0}}, {{icount, jcount, kcount}}, {{Ti, Tj, Tk}});
+      policy.set_tile_order(order);
 
       Kokkos::parallel_for(policy_initA, Init(Atest, icount, jcount, kcount));
       execution_space().fence();
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <PerfTest_Category.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace Test {
+
+using crs_type = Kokkos::Crs<int, Kokkos::DefaultExecutionSpace, void, int>;
+
+// Power-law graph: row degrees and column indices both follow a heavy
+// tailed distribution, so a few hub columns collect most of the entries.
+crs_type make_power_law_crs(int num_rows, int mean_degree) {
+  std::mt19937_64 gen(5489);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  auto degree = [&]() {
+    return static_cast<int>(mean_degree / 2 /
+                            std::sqrt(1.0 - uniform(gen) * 0.999));
+  };
+  auto column = [&]() {
+    return static_cast<int>(num_rows * std::pow(uniform(gen), 4.0)) %
+           num_rows;
+  };
+
+  Kokkos::View<int*, Kokkos::HostSpace> row_map("row_map", num_rows + 1);
+  for (int i = 0; i < num_rows; ++i) row_map(i + 1) = row_map(i) + degree();
+
+  Kokkos::View<int*, Kokkos::HostSpace> entries("entries", row_map(num_rows));
+  for (int j = 0; j < row_map(num_rows); ++j) entries(j) = column();
+
+  crs_type crs;
+  crs.row_map = crs_type::row_map_type("row_map", num_rows + 1);
+  crs.entries = crs_type::entries_type("entries", entries.extent(0));
+  Kokkos::deep_copy(crs.row_map, row_map);
+  Kokkos::deep_copy(crs.entries, entries);
+  return crs;
+}
+
+template <class Transpose>
+double time_transpose(const crs_type& in, crs_type& out, int num_trials,
+                      Transpose transpose) {
+  transpose(out, in);  // warm up
+  Kokkos::Timer timer;
+  for (int r = 0; r < num_trials; ++r) transpose(out, in);
+  return timer.seconds() / num_trials;
+}
+
+void crs_transpose_test(int num_rows, int mean_degree, int num_trials) {
+  crs_type in = make_power_law_crs(num_rows, mean_degree);
+  crs_type atomic_out, bucketed_out;
+
+  const double atomic_time =
+      time_transpose(in, atomic_out, num_trials,
+                     [](crs_type& out, const crs_type& in_) {
+                       Kokkos::transpose_crs(out, in_);
+                     });
+  const double bucketed_time =
+      time_transpose(in, bucketed_out, num_trials,
+                     [](crs_type& out, const crs_type& in_) {
+                       Kokkos::transpose_crs_bucketed(out, in_);
+                     });
+
+  auto atomic_row_map = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), atomic_out.row_map);
+  auto bucketed_row_map = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), bucketed_out.row_map);
+  int max_degree = 0;
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_EQ(atomic_row_map(i + 1), bucketed_row_map(i + 1));
+    const int degree = atomic_row_map(i + 1) - atomic_row_map(i);
+    if (degree > max_degree) max_degree = degree;
+  }
+
+  const double bytes = 2.0 * sizeof(int) * in.entries.extent(0);
+  printf(
+      "crs_transpose rows %d entries %d max transposed row %d\n"
+      "  atomic   %e s %e GB/s\n  bucketed %e s %e GB/s\n",
+      num_rows, int(in.entries.extent(0)), max_degree, atomic_time,
+      bytes / atomic_time / 1.0e9, bucketed_time,
+      bytes / bucketed_time / 1.0e9);
+}
+
+TEST(default_exec, crs_transpose) {
+  int num_rows    = 1 << 20;
+  int mean_degree = 16;
+  int num_trials  = 3;
+
+  if (command_line_num_args() > 1) num_rows = std::stoi(command_line_arg(1));
+  if (command_line_num_args() > 2) mean_degree = std::stoi(command_line_arg(2));
+  if (command_line_num_args() > 3) num_trials = std::stoi(command_line_arg(3));
+  crs_transpose_test(num_rows, mean_degree, num_trials);
+}
+
+}  // namespace Test
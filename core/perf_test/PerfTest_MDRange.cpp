@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <PerfTest_Category.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include <PerfTestMDRange.hpp>
+
+namespace Test {
+
+// Runs the MultiDimRangePerf3D stencil with a tile spanning the
+// fastest-striding dimension, which host backends iterate as collapsed rows
+// with a vectorized inner loop, and with that dimension split in two tiles,
+// which goes through the generic loop nest.  The split tiles are also run in
+// Morton tile order, where consecutive tiles share more stencil neighbours.
+template <class Layout>
+void mdrange_stencil_test(const int range, const int tile, const int iter) {
+  using perf_type =
+      MultiDimRangePerf3D<Kokkos::DefaultExecutionSpace, double, Layout>;
+  const bool right = std::is_same<Layout, Kokkos::LayoutRight>::value;
+  const int split  = (range + 1) / 2;
+
+  const double full_span =
+      right ? perf_type::test_multi_index(range, range, range, tile, tile, 0,
+                                          iter)
+            : perf_type::test_multi_index(range, range, range, 0, tile, tile,
+                                          iter);
+  const double split_span =
+      right ? perf_type::test_multi_index(range, range, range, tile, tile,
+                                          split, iter)
+            : perf_type::test_multi_index(range, range, range, split, tile,
+                                          tile, iter);
+  const double morton =
+      right ? perf_type::test_multi_index(range, range, range, tile, tile,
+                                          split, iter,
+                                          Kokkos::TileOrder::Morton)
+            : perf_type::test_multi_index(range, range, range, split, tile,
+                                          tile, iter,
+                                          Kokkos::TileOrder::Morton);
+
+  const double bytes = 2.0 * sizeof(double) * range * range * range;
+  printf(
+      "mdrange_stencil %s range %d tile %d\n"
+      "  full inner span  %e s %e GB/s\n"
+      "  split inner span %e s %e GB/s\n"
+      "  split, Morton    %e s %e GB/s\n",
+      right ? "LayoutRight" : "LayoutLeft", range, tile, full_span,
+      bytes / full_span / 1.0e9, split_span, bytes / split_span / 1.0e9,
+      morton, bytes / morton / 1.0e9);
+}
+
+TEST(default_exec, mdrange_stencil) {
+  int range = 128;
+  int tile  = 4;
+  int iter  = 10;
+
+  if (command_line_num_args() > 1) range = std::stoi(command_line_arg(1));
+  if (command_line_num_args() > 2) tile = std::stoi(command_line_arg(2));
+  if (command_line_num_args() > 3) iter = std::stoi(command_line_arg(3));
+  mdrange_stencil_test<Kokkos::LayoutRight>(range, tile, iter);
+  mdrange_stencil_test<Kokkos::LayoutLeft>(range, tile, iter);
+}
+
+// 7-point Jacobi sweep ping-ponging between the two halves of one View by
+// the parity of step
+struct JacobiStep3D {
+  Kokkos::View<double****, Kokkos::LayoutRight> u;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int step, const long i, const long j,
+                  const long k) const {
+    const int s = step % 2;
+    const int d = 1 - s;
+    u(d, i, j, k) = (u(s, i, j, k) + u(s, i - 1, j, k) + u(s, i + 1, j, k) +
+                     u(s, i, j - 1, k) + u(s, i, j + 1, k) +
+                     u(s, i, j, k - 1) + u(s, i, j, k + 1)) *
+                    (1.0 / 7.0);
+  }
+};
+
+// Runs num_steps Jacobi sweeps with 1 (one parallel_for per sweep) and with
+// more fused time steps.  Bandwidth is the traffic of unfused sweeps, one
+// read and one write per point and step, divided by the run time, so it
+// rises above the memory bandwidth as fusion keeps slabs in cache.
+void mdrange_time_steps_test(const int range, const int num_steps,
+                             const int max_fused) {
+  using policy_type = Kokkos::MDRangePolicy<Kokkos::Rank<3>>;
+  JacobiStep3D functor{decltype(JacobiStep3D::u)("u", 2, range, range, range)};
+  Kokkos::deep_copy(functor.u, 1.0);
+  const policy_type policy({1, 1, 1}, {range - 1, range - 1, range - 1});
+
+  const double bytes = 2.0 * sizeof(double) * range * range * range;
+  printf("mdrange_time_steps range %d steps %d\n", range, num_steps);
+  for (int fused = 1; fused <= max_fused; fused *= 2) {
+    Kokkos::Experimental::parallel_for_time_steps(policy, fused, 1, fused,
+                                                  functor);  // warm up
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    Kokkos::Experimental::parallel_for_time_steps(policy, num_steps, 1, fused,
+                                                  functor);
+    Kokkos::fence();
+    const double time = timer.seconds();
+    printf("  fused steps %2d %e s %e GB/s\n", fused, time,
+           bytes * num_steps / time / 1.0e9);
+  }
+}
+
+TEST(default_exec, mdrange_time_steps) {
+  int range     = 256;
+  int num_steps = 16;
+  int max_fused = 8;
+
+  if (command_line_num_args() > 1) range = std::stoi(command_line_arg(1));
+  if (command_line_num_args() > 2) num_steps = std::stoi(command_line_arg(2));
+  if (command_line_num_args() > 3) max_fused = std::stoi(command_line_arg(3));
+  mdrange_time_steps_test(range, num_steps, max_fused);
+}
+
+}  // namespace Test
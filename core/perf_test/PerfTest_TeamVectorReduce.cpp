@@ -0,0 +1,205 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <PerfTest_Category.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace Test {
+
+namespace {
+
+using team_policy = Kokkos::TeamPolicy<Kokkos::DefaultExecutionSpace>;
+using member_type = team_policy::member_type;
+using matrix_type = Kokkos::View<double**, Kokkos::LayoutRight>;
+using vector_type = Kokkos::View<double*>;
+
+// y = A x and the largest |A(i,j) x(j)| of each row, with one team per
+// block of rows, TeamThreadRange over the rows of the block and the
+// dot products over ThreadVectorRange.
+struct TeamVectorMatVec {
+  matrix_type A;
+  vector_type x, y, row_max;
+  int rows_per_team;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    const int begin = team.league_rank() * rows_per_team;
+    const int end   = begin + rows_per_team < int(A.extent(0))
+                        ? begin + rows_per_team
+                        : int(A.extent(0));
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, begin, end),
+                         [&](const int i) {
+                           double sum = 0;
+                           Kokkos::parallel_reduce(
+                               Kokkos::ThreadVectorRange(team, A.extent(1)),
+                               [&](const size_t j, double& update) {
+                                 update += A(i, j) * x(j);
+                               },
+                               sum);
+                           double max = 0;
+                           Kokkos::parallel_reduce(
+                               Kokkos::ThreadVectorRange(team, A.extent(1)),
+                               [&](const size_t j, double& update) {
+                                 const double p = A(i, j) * x(j);
+                                 const double v = p < 0 ? -p : p;
+                                 if (update < v) update = v;
+                               },
+                               Kokkos::Max<double>(max));
+                           y(i)       = sum;
+                           row_max(i) = max;
+                         });
+  }
+};
+
+// The same kernel with the dot products as plain serial loops.
+struct TeamSerialMatVec {
+  matrix_type A;
+  vector_type x, y, row_max;
+  int rows_per_team;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    const int begin = team.league_rank() * rows_per_team;
+    const int end   = begin + rows_per_team < int(A.extent(0))
+                        ? begin + rows_per_team
+                        : int(A.extent(0));
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, begin, end),
+                         [&](const int i) {
+                           double sum = 0;
+                           double max = 0;
+                           for (size_t j = 0; j < A.extent(1); ++j) {
+                             const double v = A(i, j) * x(j);
+                             sum += v;
+                             if (max < v) max = v;
+                             if (max < -v) max = -v;
+                           }
+                           y(i)       = sum;
+                           row_max(i) = max;
+                         });
+  }
+};
+
+template <class Functor>
+double time_matvec(const Functor& f, int num_teams, int vector_length,
+                   int repeat) {
+  const team_policy policy(num_teams, Kokkos::AUTO, vector_length);
+  Kokkos::parallel_for("TeamVectorMatVec", policy, f);  // warm up
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  for (int r = 0; r < repeat; ++r) {
+    Kokkos::parallel_for("TeamVectorMatVec", policy, f);
+  }
+  Kokkos::fence();
+  return timer.seconds() / repeat;
+}
+
+void team_vector_reduce_test(int rows, int cols, int repeat) {
+  const int rows_per_team = 16;
+  const int num_teams     = (rows + rows_per_team - 1) / rows_per_team;
+  const int vector_length =
+      team_policy::vector_length_max() < 8 ? team_policy::vector_length_max()
+                                           : 8;
+
+  matrix_type A("A", rows, cols);
+  vector_type x("x", cols);
+  Kokkos::parallel_for(
+      "FillA", Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, rows),
+      KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < cols; ++j) A(i, j) = ((i + 3 * j) % 7) - 3;
+      });
+  Kokkos::deep_copy(x, 0.5);
+
+  TeamVectorMatVec vector_kernel{A, x, vector_type("y", rows),
+                                 vector_type("row_max", rows), rows_per_team};
+  TeamSerialMatVec serial_kernel{A, x, vector_type("y", rows),
+                                 vector_type("row_max", rows), rows_per_team};
+
+  const double vector_time =
+      time_matvec(vector_kernel, num_teams, vector_length, repeat);
+  const double serial_time =
+      time_matvec(serial_kernel, num_teams, vector_length, repeat);
+
+  auto y_vector = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      vector_kernel.y);
+  auto y_serial = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      serial_kernel.y);
+  auto max_vector = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), vector_kernel.row_max);
+  auto max_serial = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), serial_kernel.row_max);
+  // The vectorized sum may add in a different order; every term is at most
+  // 1.5 in magnitude, which bounds the rounding difference.
+  const double tolerance = 1.5 * cols * std::numeric_limits<double>::epsilon();
+  for (int i = 0; i < rows; ++i) {
+    ASSERT_NEAR(y_vector(i), y_serial(i), tolerance);
+    ASSERT_EQ(max_vector(i), max_serial(i));
+  }
+
+  const double bytes = double(sizeof(double)) * rows * cols;
+  printf(
+      "team_vector_reduce rows %d cols %d\n"
+      "  ThreadVectorRange %e s %e GB/s\n  serial inner loop %e s %e GB/s\n",
+      rows, cols, vector_time, bytes / vector_time / 1.0e9, serial_time,
+      bytes / serial_time / 1.0e9);
+}
+
+}  // namespace
+
+TEST(default_exec, team_vector_reduce) {
+  int rows   = 4096;
+  int cols   = 1024;
+  int repeat = 20;
+
+  if (command_line_num_args() > 1) rows = std::stoi(command_line_arg(1));
+  if (command_line_num_args() > 2) cols = std::stoi(command_line_arg(2));
+  if (command_line_num_args() > 3) repeat = std::stoi(command_line_arg(3));
+  team_vector_reduce_test(rows, cols, repeat);
+}
+
+}  // namespace Test
@@ -108,6 +108,12 @@ struct Rank {
   static constexpr Iterate inner_direction = InnerDir;
 };
 
+// Order in which the host backends enumerate the tiles of an MDRangePolicy
+enum class TileOrder {
+  Lexicographic,  // Tiles follow the outer iteration direction
+  Morton          // Tiles follow a Z-order curve over the tile grid
+};
+
 namespace Impl {
 // NOTE the comparison below is encapsulated to silent warnings about pointless
 // comparison of unsigned integer with zero
@@ -179,6 +185,55 @@ constexpr NVCC_WONT_LET_ME_CALL_YOU_Array to_array_potentially_narrowing(
   }
   return a;
 }
+
+// Coordinates of tile number tile_idx when the tiles of a grid with
+// tile_end[d] tiles in dimension d are visited along a Z-order curve, with
+// the bit of dimension Fastest the least significant one at every level.
+// Extents need not be powers of two: each level skips the children of the
+// enclosing power-of-two box that lie outside the grid, so tile indices
+// stay dense in [0, product of tile_end).
+template <int Rank, int Fastest, class Point>
+void morton_tile_coordinates(typename Point::value_type tile_idx,
+                             Point const& tile_end, Point& coord) {
+  using int_type = typename Point::value_type;
+
+  int_type size = 1;
+  for (int d = 0; d < Rank; ++d) {
+    coord[d] = 0;
+    while (size < tile_end[d]) size *= 2;
+  }
+
+  for (size /= 2; size > 0; size /= 2) {
+    // Tiles in the lower half and in the whole of the current box, per
+    // dimension, and the tiles per box slice of the less significant ones
+    int_type lower[Rank];
+    int_type whole[Rank];
+    int_type slice[Rank];
+    int_type tiles = 1;
+    for (int n = 0; n < Rank; ++n) {
+      const int d         = Fastest == 0 ? n : Rank - 1 - n;
+      const int_type left = tile_end[d] - coord[d];
+      lower[d]            = left < size ? left : size;
+      whole[d]            = left < 2 * size ? left : 2 * size;
+      slice[d]            = tiles;
+      tiles *= whole[d];
+    }
+
+    // Pick the half of each dimension, most significant dimension first
+    int_type fixed = 1;
+    for (int n = Rank - 1; n >= 0; --n) {
+      const int d          = Fastest == 0 ? n : Rank - 1 - n;
+      const int_type below = fixed * lower[d] * slice[d];
+      if (tile_idx < below) {
+        fixed *= lower[d];
+      } else {
+        tile_idx -= below;
+        coord[d] += size;
+        fixed *= whole[d] - lower[d];
+      }
+    }
+  }
+}
 }  // namespace Impl
 
 // multi-dimensional iteration pattern
@@ -231,6 +286,8 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   point_type m_tile_end       = {};
   index_type m_num_tiles      = 1;
   index_type m_prod_tile_dims = 1;
+  bool m_tune_tile_size       = false;
+  TileOrder m_tile_order      = TileOrder::Lexicographic;
 
   /*
     // NDE enum impl definition alternative - replace static constexpr int ?
@@ -354,7 +411,69 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_tile(p.m_tile),
         m_tile_end(p.m_tile_end),
         m_num_tiles(p.m_num_tiles),
-        m_prod_tile_dims(p.m_prod_tile_dims) {}
+        m_prod_tile_dims(p.m_prod_tile_dims),
+        m_tune_tile_size(p.m_tune_tile_size),
+        m_tile_order(p.m_tile_order) {}
+
+  /** \brief Opt in to automatic tile selection on host backends.
+   *
+   *  The tile the policy was constructed with becomes the starting point of
+   *  a search keyed on the kernel label and iteration extents; subsequent
+   *  launches try alternative cache-fitting tiles until the fastest one is
+   *  found, after which it is reused.  A loaded tuning tool drives the
+   *  choice instead when Kokkos was initialized with tune_internals.
+   */
+  MDRangePolicy& set_tile_tuning(bool tune) {
+    m_tune_tile_size = tune;
+    return *this;
+  }
+
+  bool impl_tune_tile_size() const { return m_tune_tile_size; }
+
+  /** \brief Choose the order in which host backends enumerate tiles.
+   *
+   *  Threads receive contiguous chunks of the tile sequence, so with
+   *  TileOrder::Morton each thread works on a compact block of tiles rather
+   *  than a thin slab, which keeps a stencil's neighbouring tiles in cache
+   *  and in the TLB.  GPU backends map tiles to blocks and ignore the order.
+   */
+  MDRangePolicy& set_tile_order(TileOrder order) {
+    m_tile_order = order;
+    return *this;
+  }
+
+  TileOrder impl_tile_order() const { return m_tile_order; }
+
+  // Lower corner of tile number tile_idx in the configured tile order
+  template <typename IType>
+  void impl_tile_offset(IType tile_idx, point_type& offset) const {
+    if (m_tile_order == TileOrder::Morton) {
+      constexpr int fastest = outer_direction == Left ? 0 : rank - 1;
+      Impl::morton_tile_coordinates<rank, fastest>(
+          static_cast<array_index_type>(tile_idx), m_tile_end, offset);
+      for (int i = 0; i < rank; ++i) {
+        offset[i] = offset[i] * m_tile[i] + m_lower[i];
+      }
+    } else if (outer_direction == Left) {
+      for (int i = 0; i < rank; ++i) {
+        offset[i] = (tile_idx % m_tile_end[i]) * m_tile[i] + m_lower[i];
+        tile_idx /= m_tile_end[i];
+      }
+    } else {
+      for (int i = rank - 1; i >= 0; --i) {
+        offset[i] = (tile_idx % m_tile_end[i]) * m_tile[i] + m_lower[i];
+        tile_idx /= m_tile_end[i];
+      }
+    }
+  }
+
+  void impl_change_tile_size(const tile_type& tile) {
+    m_tile           = tile;
+    m_tile_end       = {};
+    m_num_tiles      = 1;
+    m_prod_tile_dims = 1;
+    init();
+  }
 
  private:
   void init() {
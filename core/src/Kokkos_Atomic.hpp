@@ -308,6 +308,13 @@ inline const char* atomic_query_version() {
 
 // Generic functions using the above defined functions
 #include "impl/Kokkos_Atomic_Generic_Secondary.hpp"
+
+//----------------------------------------------------------------------------
+// Atomic functions taking an explicit memory order, e.g.
+//
+// T atomic_fetch_add(volatile T* const dest, const T val, memory_order);
+
+#include "impl/Kokkos_Atomic_Explicit.hpp"
 //----------------------------------------------------------------------------
 // This atomic-style macro should be an inlined function, not a macro
 
@@ -285,6 +285,33 @@ struct ViewFill<ViewType, Layout, ExecSpace, 8, iType> {
   };
 };
 
+// Copies to or from a LayoutTiled View run one storage tile per MDRange tile
+// on host backends, so each tile is read or written as one contiguous block.
+// Other layouts, and device backends with their own tile limits, keep the
+// default tiling.
+template <class Layout, class ExecSpace, int Rank, class Enable = void>
+struct ViewCopyTile {
+  int64_t value[Rank] = {};
+};
+
+template <class Layout, class ExecSpace, int Rank>
+struct ViewCopyTile<
+    Layout, ExecSpace, Rank,
+    typename std::enable_if<
+        Kokkos::is_layouttiled<Layout>::value &&
+        Kokkos::Impl::SpaceAccessibility<
+            Kokkos::HostSpace,
+            typename ExecSpace::memory_space>::accessible>::type> {
+  int64_t value[Rank];
+
+  ViewCopyTile() {
+    const int64_t tile_dims[8] = {Layout::N0, Layout::N1, Layout::N2,
+                                  Layout::N3, Layout::N4, Layout::N5,
+                                  Layout::N6, Layout::N7};
+    for (int r = 0; r < Rank; ++r) value[r] = tile_dims[r];
+  }
+};
+
 template <class ViewTypeA, class ViewTypeB, class Layout, class ExecSpace,
           typename iType>
 struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 1, iType> {
@@ -325,9 +352,11 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 2, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
-    Kokkos::parallel_for("Kokkos::ViewCopy-2D",
-                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}),
-                         *this);
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-2D",
+        policy_type(space, {0, 0}, {a.extent(0), a.extent(1)},
+                    ViewCopyTile<Layout, ExecSpace, 2>().value),
+        *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -357,7 +386,8 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 3, iType> {
       : a(a_), b(b_) {
     Kokkos::parallel_for(
         "Kokkos::ViewCopy-3D",
-        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}),
+        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)},
+                    ViewCopyTile<Layout, ExecSpace, 3>().value),
         *this);
   }
 
@@ -388,7 +418,8 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 4, iType> {
     Kokkos::parallel_for(
         "Kokkos::ViewCopy-4D",
         policy_type(space, {0, 0, 0, 0},
-                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)}),
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)},
+                    ViewCopyTile<Layout, ExecSpace, 4>().value),
         *this);
   }
 
@@ -417,11 +448,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 5, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
-    Kokkos::parallel_for("Kokkos::ViewCopy-5D",
-                         policy_type(space, {0, 0, 0, 0, 0},
-                                     {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4)}),
-                         *this);
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-5D",
+        policy_type(space, {0, 0, 0, 0, 0},
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3),
+                     a.extent(4)},
+                    ViewCopyTile<Layout, ExecSpace, 5>().value),
+        *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -449,11 +482,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 6, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
-    Kokkos::parallel_for("Kokkos::ViewCopy-6D",
-                         policy_type(space, {0, 0, 0, 0, 0, 0},
-                                     {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4), a.extent(5)}),
-                         *this);
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-6D",
+        policy_type(space, {0, 0, 0, 0, 0, 0},
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3),
+                     a.extent(4), a.extent(5)},
+                    ViewCopyTile<Layout, ExecSpace, 6>().value),
+        *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -536,12 +571,29 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType> {
 namespace Kokkos {
 namespace Impl {
 
+// Layout whose iteration pattern drives ViewCopy: a LayoutTiled destination
+// or source takes precedence so the copy walks its storage tiles.
+template <class DstType, class SrcType, class Layout>
+struct ViewCopyLayout {
+  using type = typename std::conditional<
+      Kokkos::is_layouttiled<typename DstType::array_layout>::value,
+      typename DstType::array_layout,
+      typename std::conditional<
+          Kokkos::is_layouttiled<typename SrcType::array_layout>::value,
+          typename SrcType::array_layout, Layout>::type>::type;
+};
+
 template <class ExecutionSpace, class DstType, class SrcType>
 void view_copy(const ExecutionSpace& space, const DstType& dst,
                const SrcType& src) {
   using dst_memory_space = typename DstType::memory_space;
   using src_memory_space = typename SrcType::memory_space;
 
+  using layout_right =
+      typename ViewCopyLayout<DstType, SrcType, Kokkos::LayoutRight>::type;
+  using layout_left =
+      typename ViewCopyLayout<DstType, SrcType, Kokkos::LayoutLeft>::type;
+
   enum {
     ExecCanAccessSrc =
         Kokkos::Impl::SpaceAccessibility<ExecutionSpace,
@@ -590,27 +642,25 @@ void view_copy(const ExecutionSpace& space, const DstType& dst,
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, ExecutionSpace, DstType::Rank, int64_t>(
+            layout_right, ExecutionSpace, DstType::Rank, int64_t>(
             dst, src, space);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, ExecutionSpace, DstType::Rank, int64_t>(
+            layout_left, ExecutionSpace, DstType::Rank, int64_t>(
             dst, src, space);
     } else {
       if (iterate == Kokkos::Iterate::Right)
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, ExecutionSpace, DstType::Rank, int>(dst, src,
-                                                                     space);
+            layout_right, ExecutionSpace, DstType::Rank, int>(dst, src, space);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, ExecutionSpace, DstType::Rank, int>(dst, src,
-                                                                    space);
+            layout_left, ExecutionSpace, DstType::Rank, int>(dst, src, space);
     }
   }
 }
@@ -622,6 +672,11 @@ void view_copy(const DstType& dst, const SrcType& src) {
   using dst_memory_space    = typename DstType::memory_space;
   using src_memory_space    = typename SrcType::memory_space;
 
+  using layout_right =
+      typename ViewCopyLayout<DstType, SrcType, Kokkos::LayoutRight>::type;
+  using layout_left =
+      typename ViewCopyLayout<DstType, SrcType, Kokkos::LayoutLeft>::type;
+
   enum {
     DstExecCanAccessSrc =
         Kokkos::Impl::SpaceAccessibility<dst_execution_space,
@@ -677,27 +732,25 @@ void view_copy(const DstType& dst, const SrcType& src) {
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, dst_execution_space, DstType::Rank, int64_t>(
+            layout_right, dst_execution_space, DstType::Rank, int64_t>(
             dst, src);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, dst_execution_space, DstType::Rank, int64_t>(
-            dst, src);
+            layout_left, dst_execution_space, DstType::Rank, int64_t>(dst, src);
     } else {
       if (iterate == Kokkos::Iterate::Right)
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, src_execution_space, DstType::Rank, int64_t>(
+            layout_right, src_execution_space, DstType::Rank, int64_t>(
             dst, src);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, src_execution_space, DstType::Rank, int64_t>(
-            dst, src);
+            layout_left, src_execution_space, DstType::Rank, int64_t>(dst, src);
     }
   } else {
     if (DstExecCanAccessSrc) {
@@ -705,27 +758,23 @@ void view_copy(const DstType& dst, const SrcType& src) {
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, dst_execution_space, DstType::Rank, int>(dst,
-                                                                          src);
+            layout_right, dst_execution_space, DstType::Rank, int>(dst, src);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, dst_execution_space, DstType::Rank, int>(dst,
-                                                                         src);
+            layout_left, dst_execution_space, DstType::Rank, int>(dst, src);
     } else {
       if (iterate == Kokkos::Iterate::Right)
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutRight, src_execution_space, DstType::Rank, int>(dst,
-                                                                          src);
+            layout_right, src_execution_space, DstType::Rank, int>(dst, src);
       else
         Kokkos::Impl::ViewCopy<
             typename DstType::uniform_runtime_nomemspace_type,
             typename SrcType::uniform_runtime_const_nomemspace_type,
-            Kokkos::LayoutLeft, src_execution_space, DstType::Rank, int>(dst,
-                                                                         src);
+            layout_left, src_execution_space, DstType::Rank, int>(dst, src);
     }
   }
 }
@@ -149,6 +149,11 @@ template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
 void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
                    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in);
 
+template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
+void transpose_crs_bucketed(
+    Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
+    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in);
+
 }  // namespace Kokkos
 
 /*--------------------------------------------------------------------------*/
@@ -265,6 +270,158 @@ class FillCrsTransposeEntries {
   }
 };
 
+/* TransposeCrsBuckets
+ *   Atomic-free transpose.  The input entries are split into equal chunks
+ *   and the output rows into buckets of consecutive rows.
+ *     1. Count: every chunk counts its entries per destination bucket into
+ *        its own column of a (bucket x chunk) table.
+ *     2. Scan: the table is scanned in bucket-major order, which yields the
+ *        staging offset of every (bucket, chunk) pair.
+ *     3. Scatter: every chunk copies its (row, column) pairs into its
+ *        private slots of the destination buckets.
+ *     4. Fill: every bucket counting-sorts its staged pairs into the
+ *        output rows it owns.
+ *   Each pass writes only memory owned by its work item, and all writes of
+ *   the fill pass stay within one bucket.  Staged pairs keep their input
+ *   order, so the entries of every output row come out sorted.
+ */
+template <class InCrs, class OutCrs>
+class TransposeCrsBuckets {
+ public:
+  using execution_space = typename InCrs::execution_space;
+  using index_type      = typename InCrs::size_type;
+  using entry_type      = typename OutCrs::entries_type::non_const_value_type;
+
+ private:
+  using work_type = View<index_type*, typename InCrs::device_type>;
+  InCrs in;
+  OutCrs out;
+  index_type num_chunks;
+  index_type num_buckets;
+  index_type bucket_width;
+  work_type bucket_counts;
+  work_type bucket_offsets;
+  work_type bucket_cursors;
+  work_type row_cursors;
+  work_type staged_rows;
+  work_type staged_cols;
+
+  KOKKOS_INLINE_FUNCTION
+  index_type chunk_begin(index_type c) const {
+    return index_type(uint64_t(in.entries.extent(0)) * c / num_chunks);
+  }
+
+ public:
+  struct Count {};
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, index_type c) const {
+    const index_type end = chunk_begin(c + 1);
+    for (index_type j = chunk_begin(c); j < end; ++j) {
+      const index_type b = index_type(in.entries(j)) / bucket_width;
+      ++bucket_counts(b * num_chunks + c);
+    }
+  }
+  struct Scatter {};
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Scatter, index_type c) const {
+    const index_type begin = chunk_begin(c);
+    const index_type end   = chunk_begin(c + 1);
+    if (begin == end) return;
+    // Row containing the first entry of the chunk.
+    index_type lo = 0, hi = index_type(in.numRows());
+    while (lo + 1 < hi) {
+      const index_type mid = lo + (hi - lo) / 2;
+      if (in.row_map(mid) <= begin)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    index_type row = lo;
+    for (index_type j = begin; j < end; ++j) {
+      while (in.row_map(row + 1) <= j) ++row;
+      const index_type col = index_type(in.entries(j));
+      const index_type pos =
+          bucket_cursors((col / bucket_width) * num_chunks + c)++;
+      staged_rows(pos) = row;
+      staged_cols(pos) = col;
+    }
+  }
+  struct Fill {};
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, index_type b) const {
+    const index_type num_rows = index_type(out.numRows());
+    const index_type first    = b * bucket_width;
+    const index_type last =
+        (num_rows - first < bucket_width) ? num_rows : first + bucket_width;
+    const index_type begin = bucket_offsets(b * num_chunks);
+    const index_type end   = bucket_offsets((b + 1) * num_chunks);
+    for (index_type r = first; r < last; ++r) row_cursors(r) = 0;
+    for (index_type k = begin; k < end; ++k) ++row_cursors(staged_cols(k));
+    index_type pos = begin;
+    for (index_type r = first; r < last; ++r) {
+      const index_type n = row_cursors(r);
+      out.row_map(r)     = pos;
+      row_cursors(r)     = pos;
+      pos += n;
+    }
+    for (index_type k = begin; k < end; ++k) {
+      out.entries(row_cursors(staged_cols(k))++) = entry_type(staged_rows(k));
+    }
+    if (last == num_rows) out.row_map(num_rows) = end;
+  }
+  using self_type = TransposeCrsBuckets<InCrs, OutCrs>;
+  TransposeCrsBuckets(InCrs const& arg_in, OutCrs const& arg_out)
+      : in(arg_in), out(arg_out) {
+    const index_type num_rows    = index_type(out.numRows());
+    const index_type num_entries = index_type(in.entries.extent(0));
+    // Enough chunks to balance power-law inputs across threads, and enough
+    // buckets per chunk to keep the fill pass balanced as well.
+    num_chunks = index_type(4 * execution_space::concurrency());
+    if (num_chunks > num_entries) num_chunks = num_entries;
+    if (num_chunks < 1) num_chunks = 1;
+    num_buckets = 16 * num_chunks;
+    if (num_buckets > num_rows) num_buckets = num_rows;
+    if (num_buckets < 1) num_buckets = 1;
+    bucket_width = (num_rows + num_buckets - 1) / num_buckets;
+    if (bucket_width < 1) bucket_width = 1;
+    num_buckets = (num_rows + bucket_width - 1) / bucket_width;
+
+    bucket_counts = work_type("bucket_counts", num_buckets * num_chunks);
+    {
+      using policy_type  = RangePolicy<index_type, execution_space, Count>;
+      using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+      const closure_type closure(*this, policy_type(0, num_chunks));
+      closure.execute();
+    }
+    Kokkos::get_crs_row_map_from_counts(bucket_offsets, bucket_counts,
+                                        "bucket_offsets");
+    bucket_counts  = work_type();
+    bucket_cursors = work_type(view_alloc(WithoutInitializing, "bucket_cursors"),
+                               bucket_offsets.extent(0));
+    Kokkos::deep_copy(bucket_cursors, bucket_offsets);
+    staged_rows =
+        work_type(view_alloc(WithoutInitializing, "staged_rows"), num_entries);
+    staged_cols =
+        work_type(view_alloc(WithoutInitializing, "staged_cols"), num_entries);
+    {
+      using policy_type  = RangePolicy<index_type, execution_space, Scatter>;
+      using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+      const closure_type closure(*this, policy_type(0, num_chunks));
+      closure.execute();
+    }
+    bucket_cursors = work_type();
+    row_cursors =
+        work_type(view_alloc(WithoutInitializing, "row_cursors"), num_rows);
+    {
+      using policy_type  = RangePolicy<index_type, execution_space, Fill>;
+      using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+      const closure_type closure(*this, policy_type(0, num_buckets));
+      closure.execute();
+    }
+    execution_space().fence();
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -309,6 +466,28 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
       in, out);
 }
 
+/** \brief Transpose without atomics by scattering through buckets of
+ *         destination rows.
+ *
+ *  Produces the same graph as transpose_crs, but the entries of every
+ *  output row are sorted, and the result does not depend on thread
+ *  timing.  Needs two staging arrays of the size of the input entries.
+ */
+template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
+void transpose_crs_bucketed(
+    Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
+    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in) {
+  using crs_type = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
+  out.row_map    = decltype(out.row_map)(
+      view_alloc(WithoutInitializing, "transpose_row_map"), in.numRows() + 1);
+  out.entries = decltype(out.entries)("transpose_entries", in.entries.size());
+  if (in.numRows() == 0) {
+    Kokkos::deep_copy(out.row_map, SizeType(0));
+    return;
+  }
+  Kokkos::Impl::TransposeCrsBuckets<crs_type, crs_type> functor(in, out);
+}
+
 template <class CrsType, class Functor,
           class ExecutionSpace = typename CrsType::execution_space>
 struct CountAndFillBase;
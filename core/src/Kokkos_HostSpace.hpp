@@ -45,6 +45,7 @@
 #ifndef KOKKOS_HOSTSPACE_HPP
 #define KOKKOS_HOSTSPACE_HPP
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <iosfwd>
@@ -79,7 +80,9 @@ void init_lock_array_host_space();
 ///
 /// This function tries to acquire the lock for the hash value derived
 /// from the provided ptr. If the lock is successfully acquired the
-/// function returns true. Otherwise it returns false.
+/// function returns true. Otherwise it backs off for a period that grows
+/// exponentially with the calling thread's consecutive failures and
+/// returns false.
 bool lock_address_host_space(void* ptr);
 
 /// \brief Release lock for the address
@@ -90,8 +93,41 @@ bool lock_address_host_space(void* ptr);
 /// lock_address.
 void unlock_address_host_space(void* ptr);
 
+/// \brief Begin an optimistic read of the object at the address
+///
+/// Waits until no thread holds the lock for the address and returns the
+/// lock's sequence number, to be checked by validate_read_address_host_space
+/// once the object has been copied.
+unsigned begin_read_address_host_space(void* ptr);
+
+/// \brief Whether an optimistic read of the object at the address is valid
+///
+/// Returns true if no thread acquired the lock for the address since
+/// begin_read_address_host_space returned 'sequence'.
+bool validate_read_address_host_space(void* ptr, unsigned sequence);
+
 }  // namespace Impl
 
+namespace Tools {
+namespace Experimental {
+
+/// \brief Contention statistics of the host lock table used by atomics
+///        on types without native atomic instructions.
+struct HostAtomicLockStatistics {
+  uint64_t locks;               // Number of locks in the table
+  uint64_t acquisitions;        // Successful lock acquisitions
+  uint64_t contended;           // Failed lock attempts
+  uint64_t read_retries;        // Optimistic atomic_load reads repeated
+  uint64_t max_lock_contended;  // Failed attempts on the hottest lock
+};
+
+HostAtomicLockStatistics get_host_atomic_lock_statistics();
+
+void reset_host_atomic_lock_statistics();
+
+}  // namespace Experimental
+}  // namespace Tools
+
 }  // namespace Kokkos
 
 namespace Kokkos {
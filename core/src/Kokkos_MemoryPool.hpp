@@ -87,6 +87,9 @@ void _print_memory_pool_state(std::ostream &s, uint32_t const *sb_state_ptr,
 template <typename DeviceType>
 class MemoryPool {
  private:
+  template <typename>
+  friend class MemoryPool;
+
   using CB = Kokkos::Impl::concurrent_bitset;
 
   enum : uint32_t { bits_per_int_lg2 = CB::bits_per_int_lg2 };
@@ -270,6 +273,28 @@ class MemoryPool {
         m_data_offset(0),
         m_unused_padding(0) {}
 
+  /**\brief  View a memory pool through a compatible device type,
+   *         e.g., one with an anonymous memory space.
+   */
+  template <typename RhsDeviceType>
+  KOKKOS_INLINE_FUNCTION MemoryPool(const MemoryPool<RhsDeviceType> &rhs)
+      : m_tracker(rhs.m_tracker),
+        m_sb_state_array(rhs.m_sb_state_array),
+        m_sb_state_size(rhs.m_sb_state_size),
+        m_sb_size_lg2(rhs.m_sb_size_lg2),
+        m_max_block_size_lg2(rhs.m_max_block_size_lg2),
+        m_min_block_size_lg2(rhs.m_min_block_size_lg2),
+        m_sb_count(rhs.m_sb_count),
+        m_hint_offset(rhs.m_hint_offset),
+        m_data_offset(rhs.m_data_offset),
+        m_unused_padding(0) {
+    static_assert(
+        Kokkos::Impl::MemorySpaceAccess<
+            base_memory_space,
+            typename RhsDeviceType::memory_space>::assignable,
+        "Kokkos::MemoryPool incompatible memory space conversion");
+  }
+
   /**\brief  Allocate a memory pool from 'memspace'.
    *
    *  The memory pool will have at least 'min_total_alloc_size' bytes
@@ -61,11 +61,12 @@ namespace Kokkos {
  *  these traits are present.
  */
 enum MemoryTraitsFlags {
-  Unmanaged    = 0x01,
-  RandomAccess = 0x02,
-  Atomic       = 0x04,
-  Restrict     = 0x08,
-  Aligned      = 0x10
+  Unmanaged     = 0x01,
+  RandomAccess  = 0x02,
+  Atomic        = 0x04,
+  Restrict      = 0x08,
+  Aligned       = 0x10,
+  AtomicRelaxed = 0x20  // Atomic with relaxed memory ordering
 };
 
 template <unsigned T>
@@ -78,7 +79,13 @@ struct MemoryTraits {
   enum : bool {
     is_random_access = (unsigned(0) != (T & unsigned(Kokkos::RandomAccess)))
   };
-  enum : bool { is_atomic = (unsigned(0) != (T & unsigned(Kokkos::Atomic))) };
+  enum : bool {
+    is_atomic = (unsigned(0) !=
+                 (T & unsigned(Kokkos::Atomic | Kokkos::AtomicRelaxed)))
+  };
+  enum : bool {
+    is_atomic_relaxed = (unsigned(0) != (T & unsigned(Kokkos::AtomicRelaxed)))
+  };
   enum : bool {
     is_restrict = (unsigned(0) != (T & unsigned(Kokkos::Restrict)))
   };
@@ -0,0 +1,703 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_HPP
+#define KOKKOS_SIMD_HPP
+
+/// \file Kokkos_SIMD.hpp
+/// \brief Portable fixed-width vector types for explicitly vectorized
+///        host kernels.
+///
+/// simd<T, Abi> holds simd<T, Abi>::size() lanes of T and maps arithmetic,
+/// comparisons, math functions and masked (where) operations onto the
+/// instruction set named by Abi.  Every combination of T and Abi is
+/// usable: the primary templates in this file store the lanes in an array
+/// and loop over them, and the AVX2, AVX-512 and NEON headers specialize
+/// float and double onto intrinsics when the compiler targets those
+/// instruction sets.  simd_abi::native<T> names the widest specialized
+/// ABI for T on the host, or simd_abi::scalar when there is none.
+///
+/// Only simd_abi::scalar and simd_abi::fixed_size are usable in device
+/// code.
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+#if defined(__AVX512F__)
+#define KOKKOS_IMPL_SIMD_AVX512
+#endif
+#if defined(__AVX2__)
+#define KOKKOS_IMPL_SIMD_AVX2
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define KOKKOS_IMPL_SIMD_NEON
+#endif
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+/// One lane of T.
+struct scalar {};
+
+/// N lanes of T stored as an array, for any T and architecture.
+template <int N>
+struct fixed_size {};
+
+/// N lanes in AVX2 registers: intrinsics for 4 double or 8 float.
+template <int N>
+struct avx2_fixed_size {};
+
+/// N lanes in AVX-512 registers: intrinsics for 8 double or 16 float.
+template <int N>
+struct avx512_fixed_size {};
+
+/// N lanes in NEON registers: intrinsics for 2 double or 4 float.
+template <int N>
+struct neon_fixed_size {};
+
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+template <class T>
+using native = avx512_fixed_size<64 / sizeof(T)>;
+#elif defined(KOKKOS_IMPL_SIMD_AVX2)
+template <class T>
+using native = avx2_fixed_size<32 / sizeof(T)>;
+#elif defined(KOKKOS_IMPL_SIMD_NEON)
+template <class T>
+using native = neon_fixed_size<16 / sizeof(T)>;
+#else
+template <class T>
+using native = scalar;
+#endif
+
+}  // namespace simd_abi
+
+/// Memory passed to copy_from / copy_to is aligned to sizeof(value_type).
+struct element_aligned_tag {};
+
+/// Memory passed to copy_from / copy_to is aligned to sizeof(simd).
+struct vector_aligned_tag {};
+
+template <class T, class Abi>
+class simd;
+
+template <class T, class Abi>
+class simd_mask;
+
+namespace Impl {
+
+template <class Abi>
+struct SimdAbiSize;
+
+template <>
+struct SimdAbiSize<simd_abi::scalar> {
+  enum : int { value = 1 };
+};
+
+template <int N>
+struct SimdAbiSize<simd_abi::fixed_size<N> > {
+  enum : int { value = N };
+};
+
+template <int N>
+struct SimdAbiSize<simd_abi::avx2_fixed_size<N> > {
+  enum : int { value = N };
+};
+
+template <int N>
+struct SimdAbiSize<simd_abi::avx512_fixed_size<N> > {
+  enum : int { value = N };
+};
+
+template <int N>
+struct SimdAbiSize<simd_abi::neon_fixed_size<N> > {
+  enum : int { value = N };
+};
+
+/// G is a generator for lanes of T: callable as g(std::size_t(lane)).
+template <class G, class T, class Enable = void>
+struct IsSimdGenerator : std::false_type {};
+
+template <class G, class T>
+struct IsSimdGenerator<
+    G, T,
+    typename std::enable_if<std::is_convertible<
+        decltype(std::declval<G>()(std::size_t())), T>::value>::type>
+    : std::true_type {};
+
+}  // namespace Impl
+
+template <class T>
+struct is_simd : std::false_type {};
+
+template <class T, class Abi>
+struct is_simd<simd<T, Abi> > : std::true_type {};
+
+template <class T>
+struct is_simd_mask : std::false_type {};
+
+template <class T, class Abi>
+struct is_simd_mask<simd_mask<T, Abi> > : std::true_type {};
+
+//----------------------------------------------------------------------------
+/** \brief  Lanes of booleans, the result of comparing simd values.
+ *
+ *  The primary template stores one bool per lane.  Specializations for
+ *  intrinsic ABIs store the native mask register and provide the same
+ *  interface: a broadcast constructor, a generator constructor, read-only
+ *  lane access and the logical operators.
+ */
+template <class T, class Abi>
+class simd_mask {
+ public:
+  using value_type = bool;
+  using simd_type  = simd<T, Abi>;
+  using abi_type   = Abi;
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return Impl::SimdAbiSize<Abi>::value;
+  }
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd_mask(bool value) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = value;
+  }
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = gen(i);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    return m_value[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask([&](std::size_t i) { return a[i] && b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask([&](std::size_t i) { return a[i] || b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask([&](std::size_t i) { return !m_value[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask([&](std::size_t i) { return a[i] == b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask([&](std::size_t i) { return a[i] != b[i]; });
+  }
+
+ private:
+  bool m_value[Impl::SimdAbiSize<Abi>::value];
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool all_of(simd_mask<T, Abi> const& mask) {
+  bool result = true;
+  for (std::size_t i = 0; i < mask.size(); ++i) result = result && mask[i];
+  return result;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool any_of(simd_mask<T, Abi> const& mask) {
+  bool result = false;
+  for (std::size_t i = 0; i < mask.size(); ++i) result = result || mask[i];
+  return result;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION bool none_of(simd_mask<T, Abi> const& mask) {
+  return !any_of(mask);
+}
+
+//----------------------------------------------------------------------------
+/** \brief  Lanes of T operated on together.
+ *
+ *  The primary template stores the lanes in an array and implements each
+ *  operation as a loop the compiler can vectorize at fixed width.
+ *  Specializations for intrinsic ABIs provide the same interface:
+ *
+ *    - broadcast:  simd(value)
+ *    - generator:  simd([](std::size_t lane) { return ...; })
+ *    - conversion: explicit simd(simd<U, Abi> const&), lane by lane
+ *    - copy_from / copy_to with element_aligned_tag or vector_aligned_tag
+ *    - read-only lane access operator[]
+ *    - arithmetic, compound assignment and comparison operators
+ */
+template <class T, class Abi>
+class simd {
+ public:
+  using value_type = T;
+  using abi_type   = Abi;
+  using mask_type  = simd_mask<T, Abi>;
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return Impl::SimdAbiSize<Abi>::value;
+  }
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+
+  template <class U, typename std::enable_if<std::is_convertible<U, T>::value,
+                                             int>::type = 0>
+  KOKKOS_FORCEINLINE_FUNCTION simd(U&& value) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = value;
+  }
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, T>::value, int>::type = 0>
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = gen(i);
+  }
+
+  template <class U, typename std::enable_if<!std::is_same<U, T>::value,
+                                             int>::type = 0>
+  KOKKOS_FORCEINLINE_FUNCTION explicit simd(simd<U, Abi> const& other) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = T(other[i]);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* ptr,
+                                             element_aligned_tag) {
+    for (std::size_t i = 0; i < size(); ++i) m_value[i] = ptr[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(T const* ptr,
+                                             vector_aligned_tag) {
+    copy_from(ptr, element_aligned_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr, element_aligned_tag) const {
+    for (std::size_t i = 0; i < size(); ++i) ptr[i] = m_value[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr, vector_aligned_tag) const {
+    copy_to(ptr, element_aligned_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION T operator[](std::size_t i) const {
+    return m_value[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd([&](std::size_t i) { return -m_value[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                    simd const& b) {
+    return simd([&](std::size_t i) { return a[i] + b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                    simd const& b) {
+    return simd([&](std::size_t i) { return a[i] - b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                    simd const& b) {
+    return simd([&](std::size_t i) { return a[i] * b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                    simd const& b) {
+    return simd([&](std::size_t i) { return a[i] / b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                          simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] == b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                          simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] != b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                         simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] < b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                          simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] <= b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                         simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] > b[i]; });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                          simd const& b) {
+    return mask_type([&](std::size_t i) { return a[i] >= b[i]; });
+  }
+
+ private:
+  T m_value[Impl::SimdAbiSize<Abi>::value];
+};
+
+//----------------------------------------------------------------------------
+// Lane-wise selection and masked memory access.  These generic versions
+// use only the common interface; the ABI headers overload them for their
+// specializations with blends and masked loads and stores.
+
+/// Lane i of the result is a[i] where mask[i] is set, b[i] otherwise.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> condition(
+    simd_mask<T, Abi> const& mask, simd<T, Abi> const& a,
+    simd<T, Abi> const& b) {
+  return simd<T, Abi>([&](std::size_t i) { return mask[i] ? a[i] : b[i]; });
+}
+
+namespace Impl {
+
+/// Loads the lanes of value selected by mask from ptr.  Lanes not
+/// selected are neither read nor changed.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION void simd_masked_copy_from(
+    simd<T, Abi>& value, simd_mask<T, Abi> const& mask, T const* ptr) {
+  value = simd<T, Abi>(
+      [&](std::size_t i) { return mask[i] ? ptr[i] : value[i]; });
+}
+
+/// Stores the lanes of value selected by mask to ptr.  Lanes not
+/// selected are not written.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION void simd_masked_copy_to(
+    simd<T, Abi> const& value, simd_mask<T, Abi> const& mask, T* ptr) {
+  for (std::size_t i = 0; i < value.size(); ++i) {
+    if (mask[i]) ptr[i] = value[i];
+  }
+}
+
+}  // namespace Impl
+
+/** \brief  Read access to the lanes of a simd value selected by a mask,
+ *          as returned by where(mask, value).
+ */
+template <class M, class V>
+class const_where_expression {
+ public:
+  using value_type = typename V::value_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION const_where_expression(M const& mask,
+                                                     V const& value)
+      : m_mask(mask), m_value(value) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION M const& mask() const { return m_mask; }
+
+  KOKKOS_FORCEINLINE_FUNCTION V const& value() const { return m_value; }
+
+  template <class Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(value_type* ptr, Tag) const {
+    Impl::simd_masked_copy_to(m_value, m_mask, ptr);
+  }
+
+ protected:
+  M const& m_mask;
+  V const& m_value;
+};
+
+/** \brief  Read and write access to the lanes of a simd value selected by
+ *          a mask, as returned by where(mask, value).
+ *
+ *  Assignments and loads only change the selected lanes:
+ *
+ *    where(x < 0.0, x) = -x;
+ *    where(lane < n, x).copy_from(ptr, element_aligned_tag());
+ */
+template <class M, class V>
+class where_expression : public const_where_expression<M, V> {
+  using base_type = const_where_expression<M, V>;
+
+ public:
+  using value_type = typename base_type::value_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION where_expression(M const& mask, V& value)
+      : base_type(mask, value), m_target(value) {}
+
+  template <class Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr, Tag) {
+    Impl::simd_masked_copy_from(m_target, this->m_mask, ptr);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator=(V const& other) {
+    m_target = condition(this->m_mask, other, m_target);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator+=(V const& other) {
+    m_target = condition(this->m_mask, m_target + other, m_target);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator-=(V const& other) {
+    m_target = condition(this->m_mask, m_target - other, m_target);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator*=(V const& other) {
+    m_target = condition(this->m_mask, m_target * other, m_target);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void operator/=(V const& other) {
+    m_target = condition(this->m_mask, m_target / other, m_target);
+  }
+
+ private:
+  V& m_target;
+};
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION where_expression<simd_mask<T, Abi>, simd<T, Abi> >
+where(typename simd<T, Abi>::mask_type const& mask, simd<T, Abi>& value) {
+  return where_expression<simd_mask<T, Abi>, simd<T, Abi> >(mask, value);
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION
+    const_where_expression<simd_mask<T, Abi>, simd<T, Abi> >
+    where(typename simd<T, Abi>::mask_type const& mask,
+          simd<T, Abi> const& value) {
+  return const_where_expression<simd_mask<T, Abi>, simd<T, Abi> >(mask,
+                                                                   value);
+}
+
+//----------------------------------------------------------------------------
+// Math functions and reductions.  The generic versions apply the scalar
+// function lane by lane; the ABI headers overload the ones with a
+// matching instruction.
+
+#define KOKKOS_IMPL_SIMD_UNARY_FUNCTION(FUNC)                               \
+  template <class T, class Abi>                                             \
+  KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> FUNC(simd<T, Abi> const& x) {    \
+    return simd<T, Abi>([&](std::size_t i) { return T(std::FUNC(x[i])); }); \
+  }
+
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(abs)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(sqrt)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(cbrt)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(exp)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(log)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(sin)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(cos)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(floor)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(ceil)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(round)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(trunc)
+
+#undef KOKKOS_IMPL_SIMD_UNARY_FUNCTION
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> copysign(simd<T, Abi> const& a,
+                                                  simd<T, Abi> const& b) {
+  return simd<T, Abi>([&](std::size_t i) { return std::copysign(a[i], b[i]); });
+}
+
+/// a * b + c, rounded once where the ABI has a fused instruction.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> fma(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b,
+                                             simd<T, Abi> const& c) {
+  return simd<T, Abi>([&](std::size_t i) { return std::fma(a[i], b[i], c[i]); });
+}
+
+/// Lane-wise std::min: lane i is b[i] if b[i] < a[i], a[i] otherwise.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> min(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>([&](std::size_t i) { return b[i] < a[i] ? b[i] : a[i]; });
+}
+
+/// Lane-wise std::max: lane i is b[i] if a[i] < b[i], a[i] otherwise.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> max(simd<T, Abi> const& a,
+                                             simd<T, Abi> const& b) {
+  return simd<T, Abi>([&](std::size_t i) { return a[i] < b[i] ? b[i] : a[i]; });
+}
+
+/// Sum of the lanes.  Intrinsic ABIs add pairwise, so floating-point
+/// results may differ from a sequential sum in the last bits.
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T reduce(simd<T, Abi> const& x) {
+  T result = x[0];
+  for (std::size_t i = 1; i < x.size(); ++i) result += x[i];
+  return result;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmin(simd<T, Abi> const& x) {
+  T result = x[0];
+  for (std::size_t i = 1; i < x.size(); ++i) {
+    if (x[i] < result) result = x[i];
+  }
+  return result;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION T hmax(simd<T, Abi> const& x) {
+  T result = x[0];
+  for (std::size_t i = 1; i < x.size(); ++i) {
+    if (result < x[i]) result = x[i];
+  }
+  return result;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#if defined(KOKKOS_IMPL_SIMD_AVX2)
+#include <impl/Kokkos_SIMD_AVX2.hpp>
+#endif
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+#include <impl/Kokkos_SIMD_AVX512.hpp>
+#endif
+#if defined(KOKKOS_IMPL_SIMD_NEON)
+#include <impl/Kokkos_SIMD_NEON.hpp>
+#endif
+
+//----------------------------------------------------------------------------
+// View integration.
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+template <class SimdType, class ViewType>
+struct SimdViewAccess {
+  static_assert(ViewType::rank == 1,
+                "simd_load / simd_store require a rank one View");
+  static_assert(
+      std::is_same<typename ViewType::array_layout, LayoutLeft>::value ||
+          std::is_same<typename ViewType::array_layout, LayoutRight>::value,
+      "simd_load / simd_store require a contiguous View layout");
+  static_assert(std::is_same<typename ViewType::non_const_value_type,
+                             typename SimdType::value_type>::value,
+                "simd_load / simd_store require matching value types");
+
+  /// Mask of the lanes of [i, i + size) that fall inside the View; empty
+  /// when i is at or past the end.
+  KOKKOS_FORCEINLINE_FUNCTION static typename SimdType::mask_type in_bounds(
+      ViewType const& v, std::size_t i) {
+    const std::size_t n = i < v.extent(0) ? v.extent(0) - i : 0;
+    return typename SimdType::mask_type(
+        [=](std::size_t lane) { return lane < n; });
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Load elements [i, i + size) of a contiguous rank one View.
+ *
+ *  Lanes past the end of the View are zero and their elements are not
+ *  read, so a loop over a View in steps of SimdType::size() needs no
+ *  scalar remainder loop.
+ */
+template <class SimdType, class D, class... P>
+KOKKOS_FORCEINLINE_FUNCTION SimdType simd_load(View<D, P...> const& v,
+                                               std::size_t i) {
+  using access_type = Impl::SimdViewAccess<SimdType, View<D, P...> >;
+  SimdType result(typename SimdType::value_type(0));
+  if (i + SimdType::size() <= v.extent(0)) {
+    result.copy_from(v.data() + i, element_aligned_tag());
+  } else {
+    where(access_type::in_bounds(v, i), result)
+        .copy_from(v.data() + i, element_aligned_tag());
+  }
+  return result;
+}
+
+/** \brief  Store the lanes of value to elements [i, i + size) of a
+ *          contiguous rank one View.  Lanes past the end are dropped.
+ */
+template <class T, class Abi, class D, class... P>
+KOKKOS_FORCEINLINE_FUNCTION void simd_store(simd<T, Abi> const& value,
+                                            View<D, P...> const& v,
+                                            std::size_t i) {
+  using access_type = Impl::SimdViewAccess<simd<T, Abi>, View<D, P...> >;
+  if (i + value.size() <= v.extent(0)) {
+    value.copy_to(v.data() + i, element_aligned_tag());
+  } else {
+    where(access_type::in_bounds(v, i), value)
+        .copy_to(v.data() + i, element_aligned_tag());
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* KOKKOS_SIMD_HPP */
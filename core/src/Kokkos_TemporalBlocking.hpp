@@ -0,0 +1,284 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEMPORAL_BLOCKING_HPP
+#define KOKKOS_TEMPORAL_BLOCKING_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Kokkos {
+namespace Impl {
+
+// Binds the time step to a stencil functor called as functor(step, i...)
+template <class FunctorType>
+struct TimeStepFunctor {
+  FunctorType m_functor;
+  int m_step;
+
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(const Indices... i) const {
+    m_functor(m_step, i...);
+  }
+
+  // Called by HostIterateCollapsedTile for every point of a row
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION void apply(const Indices... i) const {
+    m_functor(m_step, i...);
+  }
+};
+
+/* \class ParallelForTimeSteps
+ * \brief Fuses several time steps of a stencil into one pass over the grid.
+ *
+ * The grid is cut along its slowest-striding dimension into slabs at least
+ * 2 * fused_steps * halo points thick, and every pass runs two phases:
+ *   1. Shrinking trapezoids: every slab runs all steps of the pass on one
+ *      thread, its faces moving inwards by halo points per step, so it
+ *      only needs values it computed itself.
+ *   2. Growing trapezoids: every interface between two slabs runs the
+ *      same steps over the gap left by phase 1, which widens by halo points
+ *      on each side per step.
+ * Each point and step is computed exactly once, and the slabs of one phase
+ * are independent.  A slab is revisited for all steps of a pass while it is
+ * still in cache, instead of streaming the whole grid once per step.
+ */
+template <class Policy, class FunctorType>
+class ParallelForTimeSteps {
+ public:
+  using execution_space = typename Policy::execution_space;
+  using point_type      = typename Policy::point_type;
+  using index_type      = typename Policy::array_index_type;
+
+ private:
+  using step_functor = TimeStepFunctor<FunctorType>;
+  using row_iterate  = HostIterateCollapsedTile<Policy, true>;
+
+  enum { rank = Policy::rank };
+  enum { blocked = Policy::inner_direction == Policy::Left ? rank - 1 : 0 };
+
+  struct Shrink {};
+  struct Grow {};
+
+  Policy m_policy;
+  FunctorType m_functor;
+  int m_halo;
+  int m_step;         // first step of the current pass
+  int m_pass_steps;   // steps in the current pass
+  index_type m_slab;  // slab thickness along the blocked dimension
+  index_type m_num_slabs;
+
+  void sweep(const int step, const index_type lower,
+             const index_type upper) const {
+    if (upper <= lower) return;
+    point_type offset = m_policy.m_lower;
+    point_type extent;
+    for (int d = 0; d < rank; ++d) {
+      extent[d] = m_policy.m_upper[d] - m_policy.m_lower[d];
+    }
+    offset[blocked] = lower;
+    extent[blocked] = upper - lower;
+    row_iterate::apply(step_functor{m_functor, step}, offset, extent,
+                       std::make_index_sequence<rank>{});
+  }
+
+  index_type slab_begin(const index_type slab) const {
+    return m_policy.m_lower[blocked] + slab * m_slab;
+  }
+
+  index_type slab_end(const index_type slab) const {
+    return slab + 1 == m_num_slabs ? m_policy.m_upper[blocked]
+                                   : slab_begin(slab + 1);
+  }
+
+  void run(const std::string& label, const int num_steps) {
+    const std::string shrink_label = label + " [shrinking trapezoids]";
+    const std::string grow_label   = label + " [growing trapezoids]";
+    for (int step = 0; step < num_steps; step += m_pass_steps) {
+      m_step = step;
+      if (num_steps - step < m_pass_steps) m_pass_steps = num_steps - step;
+      parallel_for(shrink_label,
+                   RangePolicy<execution_space, Shrink>(m_policy.space(), 0,
+                                                        m_num_slabs),
+                   *this);
+      if (m_num_slabs > 1 && m_pass_steps > 1) {
+        parallel_for(grow_label,
+                     RangePolicy<execution_space, Grow>(m_policy.space(), 1,
+                                                        m_num_slabs),
+                     *this);
+      }
+    }
+  }
+
+ public:
+  inline void operator()(Shrink, const index_type slab) const {
+    // Faces on the boundary of the range stay put
+    const index_type lower_shift = slab == 0 ? 0 : m_halo;
+    const index_type upper_shift = slab + 1 == m_num_slabs ? 0 : m_halo;
+    for (int s = 0; s < m_pass_steps; ++s) {
+      sweep(m_step + s, slab_begin(slab) + s * lower_shift,
+            slab_end(slab) - s * upper_shift);
+    }
+  }
+
+  inline void operator()(Grow, const index_type slab) const {
+    const index_type face = slab_begin(slab);
+    for (int s = 1; s < m_pass_steps; ++s) {
+      sweep(m_step + s, face - s * m_halo, face + s * m_halo);
+    }
+  }
+
+  ParallelForTimeSteps(const std::string& label, const Policy& policy,
+                       const int num_steps, const int halo,
+                       const int fused_steps, const FunctorType& functor)
+      : m_policy(policy),
+        m_functor(functor),
+        m_halo(halo),
+        m_step(0),
+        m_pass_steps(fused_steps),
+        m_slab(std::max(index_type(1), 2 * index_type(fused_steps) * halo)),
+        m_num_slabs(1) {
+    const index_type span =
+        m_policy.m_upper[blocked] - m_policy.m_lower[blocked];
+    if (span / m_slab > 1) m_num_slabs = span / m_slab;
+    run(label, num_steps);
+  }
+};
+
+// Execution spaces that cannot run the host iteration run plain sweeps
+template <class Policy, class FunctorType>
+void parallel_for_time_steps(std::false_type, const std::string& label,
+                             const Policy& policy, const int num_steps,
+                             const int /*halo*/, const int /*fused_steps*/,
+                             const FunctorType& functor) {
+  for (int step = 0; step < num_steps; ++step) {
+    parallel_for(label, policy, TimeStepFunctor<FunctorType>{functor, step});
+  }
+}
+
+template <class Policy, class FunctorType>
+void parallel_for_time_steps(std::true_type, const std::string& label,
+                             const Policy& policy, const int num_steps,
+                             const int halo, const int fused_steps,
+                             const FunctorType& functor) {
+  if (fused_steps == 1) {
+    parallel_for_time_steps(std::false_type(), label, policy, num_steps, halo,
+                            fused_steps, functor);
+  } else {
+    ParallelForTimeSteps<Policy, FunctorType>(label, policy, num_steps, halo,
+                                              fused_steps, functor);
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief Run num_steps sweeps of a stencil over an MDRangePolicy.
+ *
+ *  Equivalent to
+ *
+ *    for (int step = 0; step < num_steps; ++step)
+ *      parallel_for(policy, KOKKOS_LAMBDA(i...) { functor(step, i...); });
+ *
+ *  given that functor(step, i...) writes only the point (i...) and reads
+ *  the results of step - 1 within halo points of it, plus any values
+ *  outside the policy range, which it must not write.  The results of a
+ *  step must not overwrite those of the previous step, e.g. the functor
+ *  alternates between two Views depending on the parity of step.
+ *
+ *  On host backends up to fused_steps consecutive steps are fused by
+ *  trapezoid tiling along the slowest-striding dimension, so the grid is
+ *  streamed from memory once per fused_steps steps instead of once per
+ *  step.  Threads work on whole slabs at least 2 * fused_steps * halo
+ *  points thick along that dimension, which bounds the parallelism.  Other
+ *  backends run the plain sequence of sweeps.  Work tags are not supported.
+ */
+template <class... Properties, class FunctorType>
+void parallel_for_time_steps(const std::string& label,
+                             const MDRangePolicy<Properties...>& policy,
+                             const int num_steps, const int halo,
+                             const int fused_steps,
+                             const FunctorType& functor) {
+  using policy_type     = MDRangePolicy<Properties...>;
+  using execution_space = typename policy_type::execution_space;
+  static_assert(std::is_same<typename policy_type::work_tag, void>::value,
+                "Kokkos::Experimental::parallel_for_time_steps does not "
+                "support work tags");
+
+  if (halo < 0 || fused_steps < 1) {
+    Kokkos::abort(
+        "Kokkos::Experimental::parallel_for_time_steps: needs halo >= 0 and "
+        "fused_steps >= 1");
+  }
+
+  Kokkos::Impl::parallel_for_time_steps(
+      std::integral_constant<
+          bool, Kokkos::Impl::MemorySpaceAccess<
+                    HostSpace,
+                    typename execution_space::memory_space>::accessible>(),
+      label, policy, num_steps, halo, fused_steps, functor);
+}
+
+template <class... Properties, class FunctorType>
+void parallel_for_time_steps(const MDRangePolicy<Properties...>& policy,
+                             const int num_steps, const int halo,
+                             const int fused_steps,
+                             const FunctorType& functor) {
+  parallel_for_time_steps("", policy, num_steps, halo, fused_steps, functor);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_TEMPORAL_BLOCKING_HPP
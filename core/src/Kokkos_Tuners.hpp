@@ -56,9 +56,15 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <cassert>
 
 namespace Kokkos {
+
+// forward declarations
+template <typename... Properties>
+struct MDRangePolicy;
+
 namespace Tools {
 
 namespace Experimental {
@@ -470,6 +476,175 @@ class TeamSizeTuner {
  private:
 };
 
+/**
+ * Built-in tile search for host MDRangePolicy kernels, used when no tuning
+ * tool is loaded.
+ *
+ * Starting from the tile the policy was constructed with, every launch of
+ * the kernel runs one candidate tile and reports its time.  Times reported
+ * for a tile other than the current candidate, e.g. by a launch from another
+ * thread that started before the search moved on, are ignored.  The search is a
+ * coordinate descent: dimensions are visited from the fastest-striding one
+ * outward, and for each dimension the candidate extents are tried while the
+ * others are held at the best tile found so far.  Candidates whose point
+ * count exceeds max_tile_points are skipped so that a tile of a few
+ * double-precision arrays stays resident in a typical L2 cache.  The first
+ * launch only warms up; every tile, the starting one included, is then timed
+ * over samples_per_trial launches and the fastest of those counts.  A
+ * candidate has to beat the best tile by min_improvement to replace it, so
+ * timing noise does not walk the search away from a good starting tile.
+ */
+class MDRangeTileSearch {
+ public:
+  using tile_type      = std::vector<int64_t>;
+  using candidate_type = std::vector<std::vector<int64_t>>;
+
+  static constexpr int64_t max_tile_points = int64_t(1) << 16;
+  static constexpr int samples_per_trial    = 3;
+  static constexpr double min_improvement   = 0.03;
+
+  MDRangeTileSearch() = default;
+
+  // A tile that was learned earlier, e.g. read back from a tile cache file
+  explicit MDRangeTileSearch(tile_type best);
+
+  MDRangeTileSearch(tile_type initial, const candidate_type& candidates,
+                    bool inner_right);
+
+  bool converged() const { return m_converged; }
+  const tile_type& best() const { return m_best; }
+
+  // The tile to run for the next launch
+  const tile_type& begin_trial() const {
+    return m_converged ? m_best : m_trial;
+  }
+  // Records the time of a launch that ran the given tile
+  void end_trial(const tile_type& tile, double seconds);
+
+ private:
+  void advance();
+
+  std::vector<std::pair<size_t, int64_t>> m_moves;
+  size_t m_next_move = 0;
+  tile_type m_best;
+  tile_type m_trial;
+  double m_best_time  = -1.0;
+  double m_trial_time = 0.0;
+  int m_num_samples   = 0;
+  bool m_warmed_up    = false;
+  bool m_converged    = false;
+};
+
+/**
+ * Per-kernel tile searches, keyed on the kernel label and the iteration
+ * extents.  Converged entries are the learned tiles; they can be written to
+ * and read from a file, which is done automatically at initialize/finalize
+ * when the KOKKOS_TILE_CACHE_FILE environment variable names one.
+ */
+std::map<std::string, MDRangeTileSearch>& mdrange_tile_searches();
+// Guards mdrange_tile_searches() and the tuning tool's tile tuners, since
+// kernels may be launched from several host threads
+std::mutex& mdrange_tile_search_mutex();
+void load_mdrange_tile_cache(const std::string& filename);
+void save_mdrange_tile_cache(const std::string& filename);
+
+namespace Impl {
+
+// Candidate tile extents per dimension for a host MDRange of the given
+// spans: the full span or a large block in the fastest-striding dimension,
+// powers of two up to 64 in the next one and small powers of two elsewhere.
+MDRangeTileSearch::candidate_type mdrange_tile_candidates(
+    const std::vector<int64_t>& span, bool inner_right);
+
+template <typename T, int N>
+struct n_dimensional_sparse_structure {
+  using type =
+      std::map<T, typename n_dimensional_sparse_structure<T, N - 1>::type>;
+};
+
+template <typename T>
+struct n_dimensional_sparse_structure<T, 1> {
+  using type = std::vector<T>;
+};
+
+// Fill a nested-map tuning space with all combinations of the candidate
+// extents whose point count stays within max_points
+template <typename T>
+bool fill_tile_space(std::vector<T>& space,
+                     const MDRangeTileSearch::candidate_type& candidates,
+                     size_t dim, int64_t points, int64_t max_points) {
+  for (auto extent : candidates[dim]) {
+    if (points * extent <= max_points) space.push_back(extent);
+  }
+  return !space.empty();
+}
+
+template <typename T, typename Sub>
+bool fill_tile_space(std::map<T, Sub>& space,
+                     const MDRangeTileSearch::candidate_type& candidates,
+                     size_t dim, int64_t points, int64_t max_points) {
+  for (auto extent : candidates[dim]) {
+    Sub sub_space;
+    if (points * extent <= max_points &&
+        fill_tile_space(sub_space, candidates, dim + 1, points * extent,
+                        max_points)) {
+      space.emplace(extent, std::move(sub_space));
+    }
+  }
+  return !space.empty();
+}
+
+}  // namespace Impl
+
+/**
+ * Exposes the candidate tiles of an MDRangePolicy kernel to a tuning tool,
+ * one output variable per dimension.
+ */
+template <int Rank>
+class MDRangeTuner {
+ private:
+  using SpaceDescription =
+      typename Impl::n_dimensional_sparse_structure<int64_t, Rank>::type;
+  using TunerType = decltype(make_multidimensional_sparse_tuning_problem<20>(
+      std::declval<SpaceDescription>(),
+      std::declval<std::vector<std::string>>()));
+  TunerType tuner;
+
+  template <typename Policy, typename Tuple, size_t... Indices>
+  static void set_policy_tile(Policy& policy, const Tuple& configuration,
+                              std::index_sequence<Indices...>) {
+    policy.impl_change_tile_size({{std::get<Indices>(configuration)...}});
+  }
+
+ public:
+  MDRangeTuner() = default;
+  MDRangeTuner(const std::string& name,
+               const MDRangeTileSearch::candidate_type& candidates) {
+    SpaceDescription space_description;
+    Impl::fill_tile_space(space_description, candidates, 0, 1,
+                          MDRangeTileSearch::max_tile_points);
+    std::vector<std::string> names;
+    for (int x = 0; x < Rank; ++x) {
+      names.push_back(name + "_tile_size_" + std::to_string(x));
+    }
+    tuner = make_multidimensional_sparse_tuning_problem<20>(space_description,
+                                                            names);
+  }
+
+  template <typename... Properties>
+  void tune(Kokkos::MDRangePolicy<Properties...>& policy) {
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      auto configuration = tuner.begin();
+      set_policy_tile(policy, configuration, std::make_index_sequence<Rank>{});
+    }
+  }
+  void end() {
+    if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+      tuner.end();
+    }
+  }
+};
+
 }  // namespace Experimental
 }  // namespace Tools
 }  // namespace Kokkos
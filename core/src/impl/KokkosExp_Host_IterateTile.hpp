@@ -57,7 +57,19 @@
 #define KOKKOS_ENABLE_IVDEP_MDRANGE
 #endif
 
+// The innermost loop of a collapsed tile (HostIterateCollapsedTile) is
+// annotated with "omp simd" whenever OpenMP 4.0 directives are understood
+// (OpenMP builds, or -fopenmp-simd via KOKKOS_ENABLE_OPENMP_SIMD)
+#if ((defined(_OPENMP) && (_OPENMP >= 201307)) || \
+     defined(KOKKOS_ENABLE_OPENMP_SIMD)) &&        \
+    !defined(__CUDA_ARCH__)
+#define KOKKOS_IMPL_MDRANGE_SIMD _Pragma("omp simd")
+#else
+#define KOKKOS_IMPL_MDRANGE_SIMD KOKKOS_ENABLE_IVDEP_MDRANGE
+#endif
+
 #include <algorithm>
+#include <utility>
 
 namespace Kokkos {
 namespace Impl {
@@ -1518,6 +1530,66 @@ struct Tile_Loop_Type<
 };
 // end Structs for calling loops
 
+// Iteration of a tile that spans the full extent of the fastest-striding
+// dimension.  The other dimensions of the tile are walked as one flat
+// sequence of rows, so there is no rank-specific loop nest and no
+// full/partial tile branch, and each row is a single unit-stride loop over
+// the fastest-striding index.  Only parallel_for vectorizes that loop;
+// reductions accumulate into one value across iterations.
+template <typename RP, bool Vectorize>
+struct HostIterateCollapsedTile {
+  using point_type       = typename RP::point_type;
+  using array_index_type = typename point_type::value_type;
+  // same type as the indices passed by the Tile_Loop_Type loops
+  using arg_type = decltype(std::declval<typename RP::index_type>() +
+                            std::declval<array_index_type>());
+
+  enum { inner_rank = RP::inner_direction == RP::Left ? 0 : RP::rank - 1 };
+
+  static bool applies(RP const& rp) {
+    return rp.m_tile_end[inner_rank] == 1;
+  }
+
+  template <int Idx>
+  static KOKKOS_FORCEINLINE_FUNCTION arg_type index(point_type const& row,
+                                                     arg_type i) {
+    return Idx == inner_rank ? i : static_cast<arg_type>(row[Idx]);
+  }
+
+  template <typename Iterate, std::size_t... Idx>
+  static void apply(Iterate const& iterate, point_type const& offset,
+                    point_type const& tiledims, std::index_sequence<Idx...>) {
+    const arg_type begin = offset[inner_rank];
+    const arg_type end   = begin + tiledims[inner_rank];
+
+    array_index_type num_rows = 1;
+    for (int d = 0; d < RP::rank; ++d) {
+      if (d != inner_rank) num_rows *= tiledims[d];
+    }
+
+    point_type row = offset;
+    for (array_index_type r = 0; r < num_rows; ++r) {
+      if (Vectorize) {
+        KOKKOS_IMPL_MDRANGE_SIMD
+        for (arg_type i = begin; i < end; ++i) {
+          iterate.apply(index<Idx>(row, i)...);
+        }
+      } else {
+        for (arg_type i = begin; i < end; ++i) {
+          iterate.apply(index<Idx>(row, i)...);
+        }
+      }
+
+      // Advance to the next row, next-to-fastest dimension first
+      for (int n = 1; n < RP::rank; ++n) {
+        const int d = RP::inner_direction == RP::Left ? n : RP::rank - 1 - n;
+        if (++row[d] < offset[d] + tiledims[d]) break;
+        row[d] = offset[d];
+      }
+    }
+  }
+};
+
 template <typename T>
 using is_void_type = std::is_same<T, void>;
 
@@ -1540,8 +1612,9 @@ template <typename RP, typename Functor, typename Tag, typename ValueType>
 struct HostIterateTile<
     RP, Functor, Tag, ValueType,
     typename std::enable_if<is_void_type<ValueType>::value>::type> {
-  using index_type = typename RP::index_type;
-  using point_type = typename RP::point_type;
+  using index_type     = typename RP::index_type;
+  using point_type     = typename RP::point_type;
+  using collapsed_tile = HostIterateCollapsedTile<RP, true>;
 
   using value_type = ValueType;
 
@@ -1582,27 +1655,20 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (collapsed_tile::applies(m_rp)) {
+      collapsed_tile::apply(*this, m_offset, m_tiledims,
+                            std::make_index_sequence<RP::rank>{});
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -1618,19 +1684,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1662,19 +1716,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1706,19 +1748,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1750,19 +1780,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1794,19 +1812,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1838,19 +1844,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1882,19 +1876,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -1951,8 +1933,9 @@ struct HostIterateTile<
     RP, Functor, Tag, ValueType,
     typename std::enable_if<!is_void_type<ValueType>::value &&
                             !is_type_array<ValueType>::value>::type> {
-  using index_type = typename RP::index_type;
-  using point_type = typename RP::point_type;
+  using index_type     = typename RP::index_type;
+  using point_type     = typename RP::point_type;
+  using collapsed_tile = HostIterateCollapsedTile<RP, false>;
 
   using value_type = ValueType;
 
@@ -2003,27 +1986,20 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (collapsed_tile::applies(m_rp)) {
+      collapsed_tile::apply(*this, m_offset, m_tiledims,
+                            std::make_index_sequence<RP::rank>{});
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -2039,19 +2015,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2083,19 +2047,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2127,19 +2079,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2171,19 +2111,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2215,19 +2143,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2259,19 +2175,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2303,19 +2207,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2374,8 +2266,9 @@ struct HostIterateTile<
     RP, Functor, Tag, ValueType,
     typename std::enable_if<!is_void_type<ValueType>::value &&
                             is_type_array<ValueType>::value>::type> {
-  using index_type = typename RP::index_type;
-  using point_type = typename RP::point_type;
+  using index_type     = typename RP::index_type;
+  using point_type     = typename RP::point_type;
+  using collapsed_tile = HostIterateCollapsedTile<RP, false>;
 
   using value_type =
       typename is_type_array<ValueType>::value_type;  // strip away the
@@ -2426,27 +2319,20 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (collapsed_tile::applies(m_rp)) {
+      collapsed_tile::apply(*this, m_offset, m_tiledims,
+                            std::make_index_sequence<RP::rank>{});
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -2462,19 +2348,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2506,19 +2380,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2550,19 +2412,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2594,19 +2444,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2638,19 +2476,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2682,19 +2508,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -2726,19 +2540,7 @@ struct HostIterateTile<
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == RP::Left) {
-      for (int i = 0; i < RP::rank; ++i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    } else {
-      for (int i = RP::rank - 1; i >= 0; --i) {
-        m_offset[i] =
-            (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
-        tile_idx /= m_rp.m_tile_end[i];
-      }
-    }
+    m_rp.impl_tile_offset(tile_idx, m_offset);
 
     // Check if offset+tiledim in bounds - if not, replace tile dims with the
     // partial tile dims
@@ -89,7 +89,23 @@ struct cas128_t {
 } __attribute__((__aligned__(16)));
 #endif
 
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+// Host 16 byte compare-and-swap: cmpxchg16b on x86-64 and the LSE casp
+// instruction on AArch64.  Where it is available 16 byte types such as
+// Kokkos::complex<double> bypass the host lock table.
+#if defined(KOKKOS_ENABLE_ASM) && !defined(_WIN32) && \
+    !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+#if defined(__x86_64__) &&                                              \
+    (defined(KOKKOS_ENABLE_ISA_X86_64) || defined(KOKKOS_USE_ISA_X86_64) || \
+     defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16))
+#define KOKKOS_IMPL_ENABLE_CAS128
+#define KOKKOS_IMPL_CAS128_X86_64
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS)
+#define KOKKOS_IMPL_ENABLE_CAS128
+#define KOKKOS_IMPL_CAS128_AARCH64
+#endif
+#endif
+
+#if defined(KOKKOS_IMPL_CAS128_X86_64)
 inline cas128_t cas128(volatile cas128_t* ptr, cas128_t cmp, cas128_t swap) {
   bool swapped = false;
   __asm__ __volatile__(
@@ -99,6 +115,60 @@ inline cas128_t cas128(volatile cas128_t* ptr, cas128_t cmp, cas128_t swap) {
       : "c"(swap.upper), "b"(swap.lower), "q"(swapped));
   return cmp;
 }
+
+// Aligned 16 byte SSE loads are single-copy atomic on processors that
+// support AVX (documented by both Intel and AMD), which gives atomic_load a
+// path that never writes to the cache line.
+inline bool load128_is_atomic() {
+  static const bool is_atomic = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx") != 0;
+  }();
+  return is_atomic;
+}
+
+inline cas128_t load128(const volatile cas128_t* ptr) {
+  if (load128_is_atomic()) {
+    using vector_type = long long __attribute__((__vector_size__(16)));
+    vector_type value;
+    __asm__ __volatile__("movdqa %1, %0"
+                         : "=x"(value)
+                         : "m"(*ptr)
+                         : "memory");
+    cas128_t result;
+    result.lower = value[0];
+    result.upper = value[1];
+    return result;
+  }
+  // Older processors only read 16 bytes atomically with cmpxchg16b, which
+  // writes the (unchanged) value back.
+  cas128_t guess = cas128_t((volatile cas128_t*)ptr);
+  return cas128((volatile cas128_t*)ptr, guess, guess);
+}
+#elif defined(KOKKOS_IMPL_CAS128_AARCH64)
+inline cas128_t cas128(volatile cas128_t* ptr, cas128_t cmp, cas128_t swap) {
+  // casp needs both register pairs to start at an even register.
+  register uint64_t x0 __asm__("x0") = cmp.lower;
+  register uint64_t x1 __asm__("x1") = cmp.upper;
+  register uint64_t x2 __asm__("x2") = swap.lower;
+  register uint64_t x3 __asm__("x3") = swap.upper;
+  __asm__ __volatile__("caspal %0, %1, %2, %3, %4"
+                       : "+r"(x0), "+r"(x1), "+Q"(*ptr)
+                       : "r"(x2), "r"(x3)
+                       : "memory");
+  cmp.lower = x0;
+  cmp.upper = x1;
+  return cmp;
+}
+
+// Plain 16 byte loads are only single-copy atomic from Armv8.4 (LSE2) on,
+// which the compiler does not advertise, so loads use casp as well.
+inline bool load128_is_atomic() { return false; }
+
+inline cas128_t load128(const volatile cas128_t* ptr) {
+  cas128_t guess = cas128_t((volatile cas128_t*)ptr);
+  return cas128((volatile cas128_t*)ptr, guess, guess);
+}
 #endif
 
 }  // namespace Impl
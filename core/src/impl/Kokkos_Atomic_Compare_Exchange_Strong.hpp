@@ -233,7 +233,7 @@ inline T atomic_compare_exchange(
   return tmp.t;
 }
 
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
 template <typename T>
 inline T atomic_compare_exchange(
     volatile T* const dest, const T& compare,
@@ -261,7 +261,7 @@ template <typename T>
 inline T atomic_compare_exchange(
     volatile T* const dest, const T compare,
     typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
                                 && (sizeof(T) != 16)
 #endif
                                 ,
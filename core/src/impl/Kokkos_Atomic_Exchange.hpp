@@ -218,7 +218,7 @@ inline T atomic_exchange(volatile T* const dest,
   return old.val_T;
 }
 
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
 template <typename T>
 inline T atomic_exchange(
     volatile T* const dest,
@@ -252,7 +252,7 @@ template <typename T>
 inline T atomic_exchange(
     volatile T* const dest,
     typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
                                 && (sizeof(T) != 16)
 #endif
                                 ,
@@ -311,7 +311,7 @@ inline void atomic_assign(volatile T* const dest,
   } while (assumed != old.val_type);
 }
 
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
 template <typename T>
 inline void atomic_assign(
     volatile T* const dest,
@@ -340,7 +340,7 @@ template <typename T>
 inline void atomic_assign(
     volatile T* const dest,
     typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
                                 && (sizeof(T) != 16)
 #endif
                                 ,
@@ -0,0 +1,378 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#if defined(KOKKOS_ATOMIC_HPP) && !defined(KOKKOS_ATOMIC_EXPLICIT_HPP)
+#define KOKKOS_ATOMIC_EXPLICIT_HPP
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Atomic_Memory_Order.hpp>
+
+/** @file
+ * Atomic functions taking an explicit memory order:
+ *
+ *   T atomic_fetch_add(volatile T* dest, T val, MemoryOrder);
+ *   atomic_fetch_sub, atomic_fetch_min, atomic_fetch_max,
+ *   atomic_fetch_and, atomic_fetch_or, atomic_exchange,
+ *   atomic_add, atomic_sub, atomic_increment, atomic_decrement,
+ *   T atomic_compare_exchange(volatile T* dest, T compare, T val, MemoryOrder);
+ *   T atomic_load(T* ptr, MemoryOrder);
+ *   void atomic_store(T* ptr, T val, MemoryOrder);
+ *
+ * MemoryOrder is one of Kokkos::memory_order_relaxed, _acquire, _release,
+ * _acq_rel or _seq_cst.  Sequentially consistent requests use the existing
+ * atomics.  Weaker orders map to the compiler builtins on hosts with GNU
+ * compatible atomics for word-sized types; elsewhere they fall back to the
+ * sequentially consistent implementation, which is always a valid, if
+ * stronger, choice.
+ */
+
+namespace Kokkos {
+namespace Impl {
+
+template <class MemoryOrder>
+struct is_weak_memory_order
+    : std::integral_constant<
+          bool, std::is_same<MemoryOrder, memory_order_relaxed_t>::value ||
+                    std::is_same<MemoryOrder, memory_order_acquire_t>::value ||
+                    std::is_same<MemoryOrder, memory_order_release_t>::value ||
+                    std::is_same<MemoryOrder, memory_order_acq_rel_t>::value> {
+};
+
+#if defined(KOKKOS_ENABLE_GNU_ATOMICS) || defined(KOKKOS_ENABLE_INTEL_ATOMICS)
+#define KOKKOS_IMPL_ATOMIC_EXPLICIT_BUILTINS
+
+template <class T>
+struct atomic_explicit_select {
+  static constexpr bool word = sizeof(T) == 1 || sizeof(T) == 2 ||
+                               sizeof(T) == 4 || sizeof(T) == 8;
+  static constexpr bool integral = word && std::is_integral<T>::value;
+};
+
+// A failed compare-exchange does not store, so it can not release.
+template <class MemoryOrder>
+constexpr int atomic_explicit_failure_order() {
+  return std::is_same<MemoryOrder, memory_order_release_t>::value
+             ? __ATOMIC_RELAXED
+             : (std::is_same<MemoryOrder, memory_order_acq_rel_t>::value
+                    ? __ATOMIC_ACQUIRE
+                    : MemoryOrder::gnu_constant);
+}
+
+template <class Oper, class T, class MemoryOrder>
+inline T atomic_fetch_oper_explicit(
+    const Oper& op, volatile T* const dest, const T val, MemoryOrder,
+    typename std::enable_if<atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  T oldval;
+  __atomic_load(dest, &oldval, __ATOMIC_RELAXED);
+  T newval;
+  do {
+    if (check_early_exit(op, oldval, val)) return oldval;
+    newval = op.apply(oldval, val);
+  } while (!__atomic_compare_exchange(
+      dest, &oldval, &newval, true, MemoryOrder::gnu_constant,
+      atomic_explicit_failure_order<MemoryOrder>()));
+  return oldval;
+}
+
+template <class Oper, class T, class MemoryOrder>
+inline T atomic_fetch_oper_explicit(
+    const Oper& op, volatile T* const dest, const T val, MemoryOrder,
+    typename std::enable_if<!atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  return Impl::atomic_fetch_oper(op, dest, val);
+}
+
+#define KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN(NAME, BUILTIN, OPER)      \
+  template <class T, class MemoryOrder>                                     \
+  inline T NAME(volatile T* const dest, const T val, MemoryOrder order,     \
+                typename std::enable_if<atomic_explicit_select<T>::integral, \
+                                        void const**>::type = nullptr) {    \
+    (void)order;                                                            \
+    return BUILTIN(dest, val, MemoryOrder::gnu_constant);                   \
+  }                                                                         \
+  template <class T, class MemoryOrder>                                     \
+  inline T NAME(                                                            \
+      volatile T* const dest, const T val, MemoryOrder order,               \
+      typename std::enable_if<!atomic_explicit_select<T>::integral,         \
+                              void const**>::type = nullptr) {              \
+    return atomic_fetch_oper_explicit(OPER<T, const T>(), dest, val, order); \
+  }
+
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN(atomic_fetch_add_explicit,
+                                          __atomic_fetch_add, AddOper)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN(atomic_fetch_sub_explicit,
+                                          __atomic_fetch_sub, SubOper)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN(atomic_fetch_and_explicit,
+                                          __atomic_fetch_and, AndOper)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN(atomic_fetch_or_explicit,
+                                          __atomic_fetch_or, OrOper)
+
+#undef KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH_BUILTIN
+
+template <class T, class MemoryOrder>
+inline T atomic_exchange_explicit(
+    volatile T* const dest, const T val, MemoryOrder,
+    typename std::enable_if<atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  T newval = val;
+  T oldval;
+  __atomic_exchange(dest, &newval, &oldval, MemoryOrder::gnu_constant);
+  return oldval;
+}
+
+template <class T, class MemoryOrder>
+inline T atomic_exchange_explicit(
+    volatile T* const dest, const T val, MemoryOrder,
+    typename std::enable_if<!atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  return Kokkos::atomic_exchange(dest, val);
+}
+
+template <class T, class MemoryOrder>
+inline T atomic_compare_exchange_explicit(
+    volatile T* const dest, const T compare, const T val, MemoryOrder,
+    typename std::enable_if<atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  T oldval = compare;
+  T newval = val;
+  __atomic_compare_exchange(dest, &oldval, &newval, false,
+                            MemoryOrder::gnu_constant,
+                            atomic_explicit_failure_order<MemoryOrder>());
+  return oldval;
+}
+
+template <class T, class MemoryOrder>
+inline T atomic_compare_exchange_explicit(
+    volatile T* const dest, const T compare, const T val, MemoryOrder,
+    typename std::enable_if<!atomic_explicit_select<T>::word,
+                            void const**>::type = nullptr) {
+  return Kokkos::atomic_compare_exchange(dest, compare, val);
+}
+#endif
+
+}  // namespace Impl
+
+// Host code with GNU compatible atomics honors the requested order,
+// everything else uses the sequentially consistent implementation.
+#if defined(KOKKOS_IMPL_ATOMIC_EXPLICIT_BUILTINS) && \
+    defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+#define KOKKOS_IMPL_ATOMIC_EXPLICIT(EXPLICIT, SEQ_CST) return EXPLICIT;
+#else
+#define KOKKOS_IMPL_ATOMIC_EXPLICIT(EXPLICIT, SEQ_CST) \
+  (void)order;                                         \
+  return SEQ_CST;
+#endif
+
+#define KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(NAME)                               \
+  template <class T>                                                          \
+  KOKKOS_INLINE_FUNCTION T NAME(volatile T* const dest,                       \
+                                typename std::enable_if<true, const T>::type \
+                                    val,                                      \
+                                Impl::memory_order_seq_cst_t) {               \
+    return NAME(dest, val);                                                   \
+  }                                                                           \
+  template <class T, class MemoryOrder>                                       \
+  KOKKOS_INLINE_FUNCTION T NAME(                                              \
+      volatile T* const dest,                                                 \
+      typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value, \
+                              const T>::type val,                             \
+      MemoryOrder order) {                                                    \
+    KOKKOS_IMPL_ATOMIC_EXPLICIT(                                              \
+        Impl::NAME##_explicit(dest, val, order), NAME(dest, val))             \
+  }
+
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(atomic_fetch_add)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(atomic_fetch_sub)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(atomic_fetch_and)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(atomic_fetch_or)
+KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH(atomic_exchange)
+
+#undef KOKKOS_IMPL_ATOMIC_EXPLICIT_FETCH
+
+template <class T>
+KOKKOS_INLINE_FUNCTION T
+atomic_fetch_min(volatile T* const dest,
+                 typename std::enable_if<true, const T>::type val,
+                 Impl::memory_order_seq_cst_t) {
+  return atomic_fetch_min(dest, val);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION T atomic_fetch_min(
+    volatile T* const dest,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            const T>::type val,
+    MemoryOrder order) {
+  KOKKOS_IMPL_ATOMIC_EXPLICIT(
+      Impl::atomic_fetch_oper_explicit(Impl::MinOper<T, const T>(), dest, val,
+                                       order),
+      atomic_fetch_min(dest, val))
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION T
+atomic_fetch_max(volatile T* const dest,
+                 typename std::enable_if<true, const T>::type val,
+                 Impl::memory_order_seq_cst_t) {
+  return atomic_fetch_max(dest, val);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION T atomic_fetch_max(
+    volatile T* const dest,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            const T>::type val,
+    MemoryOrder order) {
+  KOKKOS_IMPL_ATOMIC_EXPLICIT(
+      Impl::atomic_fetch_oper_explicit(Impl::MaxOper<T, const T>(), dest, val,
+                                       order),
+      atomic_fetch_max(dest, val))
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION T
+atomic_compare_exchange(volatile T* const dest,
+                        typename std::enable_if<true, const T>::type compare,
+                        typename std::enable_if<true, const T>::type val,
+                        Impl::memory_order_seq_cst_t) {
+  return atomic_compare_exchange(dest, compare, val);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION T atomic_compare_exchange(
+    volatile T* const dest,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            const T>::type compare,
+    typename std::enable_if<true, const T>::type val, MemoryOrder order) {
+  KOKKOS_IMPL_ATOMIC_EXPLICIT(
+      Impl::atomic_compare_exchange_explicit(dest, compare, val, order),
+      atomic_compare_exchange(dest, compare, val))
+}
+
+#undef KOKKOS_IMPL_ATOMIC_EXPLICIT
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void atomic_add(
+    volatile T* const dest, typename std::enable_if<true, const T>::type val,
+    Impl::memory_order_seq_cst_t) {
+  atomic_add(dest, val);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION void atomic_add(
+    volatile T* const dest,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            const T>::type val,
+    MemoryOrder order) {
+  (void)atomic_fetch_add(dest, val, order);
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void atomic_sub(
+    volatile T* const dest, typename std::enable_if<true, const T>::type val,
+    Impl::memory_order_seq_cst_t) {
+  atomic_sub(dest, val);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION void atomic_sub(
+    volatile T* const dest,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            const T>::type val,
+    MemoryOrder order) {
+  (void)atomic_fetch_sub(dest, val, order);
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void atomic_increment(volatile T* const dest,
+                                             Impl::memory_order_seq_cst_t) {
+  atomic_increment(dest);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION void atomic_increment(
+    volatile T* const dest, MemoryOrder order,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            void const**>::type = nullptr) {
+  (void)atomic_fetch_add(dest, T(1), order);
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void atomic_decrement(volatile T* const dest,
+                                             Impl::memory_order_seq_cst_t) {
+  atomic_decrement(dest);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION void atomic_decrement(
+    volatile T* const dest, MemoryOrder order,
+    typename std::enable_if<Impl::is_weak_memory_order<MemoryOrder>::value,
+                            void const**>::type = nullptr) {
+  (void)atomic_fetch_sub(dest, T(1), order);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION T atomic_load(
+    T* ptr, MemoryOrder order,
+    typename std::enable_if<std::is_same<typename MemoryOrder::memory_order,
+                                         MemoryOrder>::value,
+                            void const**>::type = nullptr) {
+  return Impl::atomic_load(ptr, order);
+}
+
+template <class T, class MemoryOrder>
+KOKKOS_INLINE_FUNCTION void atomic_store(
+    T* ptr, typename std::enable_if<true, const T>::type val,
+    MemoryOrder order,
+    typename std::enable_if<std::is_same<typename MemoryOrder::memory_order,
+                                         MemoryOrder>::value,
+                            void const**>::type = nullptr) {
+  Impl::atomic_store(ptr, val, order);
+}
+
+}  // namespace Kokkos
+
+#undef KOKKOS_IMPL_ATOMIC_EXPLICIT_BUILTINS
+
+#endif
@@ -296,7 +296,7 @@ inline T atomic_fetch_add(volatile T* const dest,
   return oldval.t;
 }
 
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
 template <typename T>
 inline T atomic_fetch_add(
     volatile T* const dest,
@@ -332,7 +332,7 @@ template <typename T>
 inline T atomic_fetch_add(
     volatile T* const dest,
     typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
-#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
                                 && (sizeof(T) != 16)
 #endif
                                 ,
@@ -283,17 +283,76 @@ KOKKOS_INLINE_FUNCTION T atomic_oper_fetch(
   return newval.t;
 }
 
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
 template <class Oper, typename T>
-KOKKOS_INLINE_FUNCTION T atomic_fetch_oper(
+inline T atomic_fetch_oper(
     const Oper& op, volatile T* const dest,
-    typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8), const T>::type
+    typename std::enable_if<sizeof(T) == sizeof(Impl::cas128_t), const T>::type
         val) {
+  union U {
+    Impl::cas128_t i;
+    T t;
+    inline U() {}
+  } oldval, assume, newval;
+
+  // The plain 16 byte read may tear, so it is only a guess that a
+  // compare-and-swap with itself turns into a consistent snapshot before
+  // the early exit test looks at it.
+  oldval.i = Impl::cas128_t((volatile Impl::cas128_t*)dest);
+  oldval.i = Impl::cas128((volatile Impl::cas128_t*)dest, oldval.i, oldval.i);
+
+  do {
+    if (check_early_exit(op, oldval.t, val)) return oldval.t;
+    assume.i = oldval.i;
+    newval.t = op.apply(assume.t, val);
+    oldval.i = Impl::cas128((volatile Impl::cas128_t*)dest, assume.i, newval.i);
+  } while (assume.i != oldval.i);
+
+  return oldval.t;
+}
+
+template <class Oper, typename T>
+inline T atomic_oper_fetch(
+    const Oper& op, volatile T* const dest,
+    typename std::enable_if<sizeof(T) == sizeof(Impl::cas128_t), const T>::type
+        val) {
+  union U {
+    Impl::cas128_t i;
+    T t;
+    inline U() {}
+  } oldval, assume, newval;
+
+  // See atomic_fetch_oper above
+  oldval.i = Impl::cas128_t((volatile Impl::cas128_t*)dest);
+  oldval.i = Impl::cas128((volatile Impl::cas128_t*)dest, oldval.i, oldval.i);
+
+  do {
+    if (check_early_exit(op, oldval.t, val)) return oldval.t;
+    assume.i = oldval.i;
+    newval.t = op.apply(assume.t, val);
+    oldval.i = Impl::cas128((volatile Impl::cas128_t*)dest, assume.i, newval.i);
+  } while (assume.i != oldval.i);
+
+  return newval.t;
+}
+#endif
+
+template <class Oper, typename T>
+KOKKOS_INLINE_FUNCTION T atomic_fetch_oper(
+    const Oper& op, volatile T* const dest,
+    typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+                                && (sizeof(T) != 16)
+#endif
+                                ,
+                            const T>::type val) {
 #ifdef KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST
   while (!Impl::lock_address_host_space((void*)dest))
     ;
   Kokkos::memory_fence();
-  T return_val = *dest;
-  *dest        = op.apply(return_val, val);
+  T return_val   = *dest;
+  const T new_val = op.apply(return_val, val);
+  *dest           = new_val;
   Kokkos::memory_fence();
   Impl::unlock_address_host_space((void*)dest);
   return return_val;
@@ -357,8 +416,7 @@ template <class Oper, typename T>
 KOKKOS_INLINE_FUNCTION T
 atomic_oper_fetch(const Oper& op, volatile T* const dest,
                   typename std::enable_if<(sizeof(T) != 4) && (sizeof(T) != 8)
-#if defined(KOKKOS_ENABLE_ASM) && \
-    defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
                                               && (sizeof(T) != 16)
 #endif
                                               ,
@@ -48,6 +48,7 @@
 #if defined(KOKKOS_ATOMIC_HPP)
 
 #include <impl/Kokkos_Atomic_Memory_Order.hpp>
+#include <cstring>
 #include <impl/Kokkos_Atomic_Generic.hpp>
 
 #if defined(KOKKOS_ENABLE_CUDA)
@@ -69,12 +70,36 @@ namespace Impl {
 #define KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH inline
 #endif
 
+// Selects the implementation of atomic_load and atomic_store for T.  On the
+// host every type that is not a machine word must agree with the generic
+// read-modify-write atomics: 16 byte types use the double-width CAS where
+// it is available and everything else goes through the host lock table.
+template <class T>
+struct atomic_load_store_select {
+  static constexpr bool word = sizeof(T) == 1 || sizeof(T) == 2 ||
+                               sizeof(T) == 4 || sizeof(T) == 8;
+  static constexpr bool builtin_n =
+      word && (std::is_integral<T>::value || std::is_enum<T>::value ||
+               std::is_pointer<T>::value);
+#if defined(__CUDA_ARCH__)
+  static constexpr bool builtin = !builtin_n;
+  static constexpr bool cas128  = false;
+#else
+  static constexpr bool builtin = word && !builtin_n;
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+  static constexpr bool cas128 = sizeof(T) == sizeof(Impl::cas128_t);
+#else
+  static constexpr bool cas128 = false;
+#endif
+#endif
+  static constexpr bool locked = !word && !builtin && !cas128;
+};
+
 template <class T, class MemoryOrder>
 KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH T _atomic_load(
     T* ptr, MemoryOrder,
     typename std::enable_if<
-        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
-         sizeof(T) == 8) &&
+        atomic_load_store_select<T>::builtin_n &&
             std::is_same<typename MemoryOrder::memory_order,
                          typename std::remove_cv<MemoryOrder>::type>::value,
         void const**>::type = nullptr) {
@@ -85,8 +110,7 @@ template <class T, class MemoryOrder>
 KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH T _atomic_load(
     T* ptr, MemoryOrder,
     typename std::enable_if<
-        !(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
-          sizeof(T) == 8) &&
+        atomic_load_store_select<T>::builtin &&
             std::is_default_constructible<T>::value &&
             std::is_same<typename MemoryOrder::memory_order,
                          typename std::remove_cv<MemoryOrder>::type>::value,
@@ -96,6 +120,47 @@ KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH T _atomic_load(
   return rv;
 }
 
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+template <class T, class MemoryOrder>
+inline T _atomic_load(
+    T* ptr, MemoryOrder,
+    typename std::enable_if<
+        atomic_load_store_select<T>::cas128 &&
+            std::is_same<typename MemoryOrder::memory_order,
+                         typename std::remove_cv<MemoryOrder>::type>::value,
+        void const**>::type = nullptr) {
+  union U {
+    Impl::cas128_t i;
+    typename std::remove_cv<T>::type t;
+    inline U() {}
+  } tmp;
+  tmp.i = Impl::load128((const volatile Impl::cas128_t*)ptr);
+  return tmp.t;
+}
+#endif
+
+#if !defined(__CUDA_ARCH__)
+// Read optimistically against the sequence number of the lock that guards
+// the address, so that concurrent loads do not serialize on the lock.
+template <class T, class MemoryOrder>
+inline T _atomic_load(
+    T* ptr, MemoryOrder,
+    typename std::enable_if<
+        atomic_load_store_select<T>::locked &&
+            std::is_default_constructible<T>::value &&
+            std::is_same<typename MemoryOrder::memory_order,
+                         typename std::remove_cv<MemoryOrder>::type>::value,
+        void const**>::type = nullptr) {
+  T rv{};
+  unsigned sequence;
+  do {
+    sequence = Impl::begin_read_address_host_space((void*)ptr);
+    std::memcpy((void*)&rv, (const void*)ptr, sizeof(T));
+  } while (!Impl::validate_read_address_host_space((void*)ptr, sequence));
+  return rv;
+}
+#endif
+
 #undef KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH
 
 #elif defined(__CUDA_ARCH__)
@@ -116,6 +116,15 @@ constexpr memory_order_acq_rel_t memory_order_acq_rel = {};
 // Intentionally omit consume (for now)
 
 }  // end namespace Impl
+
+// Memory orders accepted by the atomic functions, e.g.
+//   Kokkos::atomic_fetch_add(&count, 1, Kokkos::memory_order_relaxed);
+using Impl::memory_order_acq_rel;
+using Impl::memory_order_acquire;
+using Impl::memory_order_relaxed;
+using Impl::memory_order_release;
+using Impl::memory_order_seq_cst;
+
 }  // end namespace Kokkos
 
 #endif  // KOKKOS_KOKKOS_ATOMIC_MEMORY_ORDER_HPP
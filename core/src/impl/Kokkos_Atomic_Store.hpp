@@ -48,7 +48,9 @@
 #if defined(KOKKOS_ATOMIC_HPP)
 
 #include <impl/Kokkos_Atomic_Memory_Order.hpp>
+#include <cstring>
 #include <impl/Kokkos_Atomic_Generic.hpp>
+#include <impl/Kokkos_Atomic_Load.hpp>
 
 #if defined(KOKKOS_ENABLE_CUDA)
 #include <Cuda/Kokkos_Cuda_Atomic_Intrinsics.hpp>
@@ -73,8 +75,7 @@ template <class T, class MemoryOrder>
 KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH void _atomic_store(
     T* ptr, T val, MemoryOrder,
     typename std::enable_if<
-        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
-         sizeof(T) == 8) &&
+        atomic_load_store_select<T>::builtin_n &&
             std::is_same<typename MemoryOrder::memory_order,
                          typename std::remove_cv<MemoryOrder>::type>::value,
         void const**>::type = nullptr) {
@@ -85,8 +86,7 @@ template <class T, class MemoryOrder>
 KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH void _atomic_store(
     T* ptr, T val, MemoryOrder,
     typename std::enable_if<
-        !(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
-          sizeof(T) == 8) &&
+        atomic_load_store_select<T>::builtin &&
             std::is_default_constructible<T>::value &&
             std::is_same<typename MemoryOrder::memory_order,
                          typename std::remove_cv<MemoryOrder>::type>::value,
@@ -94,6 +94,49 @@ KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH void _atomic_store(
   __atomic_store(ptr, &val, MemoryOrder::gnu_constant);
 }
 
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+template <class T, class MemoryOrder>
+inline void _atomic_store(
+    T* ptr, T val, MemoryOrder,
+    typename std::enable_if<
+        atomic_load_store_select<T>::cas128 &&
+            std::is_same<typename MemoryOrder::memory_order,
+                         typename std::remove_cv<MemoryOrder>::type>::value,
+        void const**>::type = nullptr) {
+  union U {
+    Impl::cas128_t i;
+    T t;
+    inline U() {}
+  } assume, oldval, newval;
+
+  newval.t = val;
+  oldval.i = Impl::cas128_t((volatile Impl::cas128_t*)ptr);
+  do {
+    assume.i = oldval.i;
+    oldval.i = Impl::cas128((volatile Impl::cas128_t*)ptr, assume.i, newval.i);
+  } while (assume.i != oldval.i);
+}
+#endif
+
+#if !defined(__CUDA_ARCH__)
+// Store under the host lock table, so that the store is ordered with the
+// lock based read-modify-write operations and with sequence validated loads.
+template <class T, class MemoryOrder>
+inline void _atomic_store(
+    T* ptr, T val, MemoryOrder,
+    typename std::enable_if<
+        atomic_load_store_select<T>::locked &&
+            std::is_default_constructible<T>::value &&
+            std::is_same<typename MemoryOrder::memory_order,
+                         typename std::remove_cv<MemoryOrder>::type>::value,
+        void const**>::type = nullptr) {
+  while (!Impl::lock_address_host_space((void*)ptr))
+    ;
+  std::memcpy((void*)ptr, (const void*)&val, sizeof(T));
+  Impl::unlock_address_host_space((void*)ptr);
+}
+#endif
+
 #undef KOKKOS_INTERNAL_INLINE_DEVICE_IF_CUDA_ARCH
 
 #elif defined(__CUDA_ARCH__)
@@ -60,6 +60,9 @@ class AtomicDataElement {
   using value_type           = typename ViewTraits::value_type;
   using const_value_type     = typename ViewTraits::const_value_type;
   using non_const_value_type = typename ViewTraits::non_const_value_type;
+  using memory_order         = typename std::conditional<
+      ViewTraits::memory_traits::is_atomic_relaxed,
+      Impl::memory_order_relaxed_t, Impl::memory_order_seq_cst_t>::type;
   volatile value_type* const ptr;
 
   KOKKOS_INLINE_FUNCTION
@@ -77,54 +80,56 @@ class AtomicDataElement {
   }
 
   KOKKOS_INLINE_FUNCTION
-  void inc() const { Kokkos::atomic_increment(ptr); }
+  void inc() const { Kokkos::atomic_increment(ptr, memory_order()); }
 
   KOKKOS_INLINE_FUNCTION
-  void dec() const { Kokkos::atomic_decrement(ptr); }
+  void dec() const { Kokkos::atomic_decrement(ptr, memory_order()); }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
-    const_value_type tmp =
-        Kokkos::atomic_fetch_add(ptr, non_const_value_type(1));
+    const_value_type tmp = Kokkos::atomic_fetch_add(
+        ptr, non_const_value_type(1), memory_order());
     return tmp + 1;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
-    const_value_type tmp =
-        Kokkos::atomic_fetch_sub(ptr, non_const_value_type(1));
+    const_value_type tmp = Kokkos::atomic_fetch_sub(
+        ptr, non_const_value_type(1), memory_order());
     return tmp - 1;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
-    return Kokkos::atomic_fetch_add(ptr, non_const_value_type(1));
+    return Kokkos::atomic_fetch_add(ptr, non_const_value_type(1),
+                                    memory_order());
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
-    return Kokkos::atomic_fetch_sub(ptr, non_const_value_type(1));
+    return Kokkos::atomic_fetch_sub(ptr, non_const_value_type(1),
+                                    memory_order());
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type& val) const {
-    const_value_type tmp = Kokkos::atomic_fetch_add(ptr, val);
+    const_value_type tmp = Kokkos::atomic_fetch_add(ptr, val, memory_order());
     return tmp + val;
   }
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(volatile const_value_type& val) const {
-    const_value_type tmp = Kokkos::atomic_fetch_add(ptr, val);
+    const_value_type tmp = Kokkos::atomic_fetch_add(ptr, val, memory_order());
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type& val) const {
-    const_value_type tmp = Kokkos::atomic_fetch_sub(ptr, val);
+    const_value_type tmp = Kokkos::atomic_fetch_sub(ptr, val, memory_order());
     return tmp - val;
   }
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(volatile const_value_type& val) const {
-    const_value_type tmp = Kokkos::atomic_fetch_sub(ptr, val);
+    const_value_type tmp = Kokkos::atomic_fetch_sub(ptr, val, memory_order());
     return tmp - val;
   }
 
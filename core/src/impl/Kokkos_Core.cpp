@@ -318,6 +318,20 @@ void finalize_internal(const bool all_spaces = false) {
     ++numSuccessfulCalls;
   }
 
+  // Report contention on the host atomic lock table to a loaded tool.
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    const auto locks =
+        Kokkos::Tools::Experimental::get_host_atomic_lock_statistics();
+    if (locks.acquisitions > 0) {
+      std::ostringstream event;
+      event << "Kokkos::HostSpace atomic locks: locks " << locks.locks
+            << " acquisitions " << locks.acquisitions << " contended "
+            << locks.contended << " read_retries " << locks.read_retries
+            << " max_lock_contended " << locks.max_lock_contended;
+      Kokkos::Profiling::markEvent(event.str());
+    }
+  }
+
   Kokkos::Profiling::finalize();
 
   Impl::ExecSpaceManager::get_instance().finalize_spaces(all_spaces);
@@ -101,6 +101,7 @@
 #include <Kokkos_HostSpace.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <Kokkos_Atomic.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 
 #if (defined(KOKKOS_ENABLE_ASM) || defined(KOKKOS_ENABLE_TM)) && \
     defined(KOKKOS_ENABLE_ISA_X86_64) && !defined(KOKKOS_COMPILER_PGI)
@@ -500,46 +501,114 @@ void SharedAllocationRecord<Kokkos::HostSpace, void>::print_records(
 
 namespace Kokkos {
 namespace {
-const unsigned HOST_SPACE_ATOMIC_MASK     = 0xFFFF;
-const unsigned HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
-static int HOST_SPACE_ATOMIC_LOCKS[HOST_SPACE_ATOMIC_MASK + 1];
+
+// One lock per cache line so that neighbouring locks do not share lines.
+// 'sequence' is odd while the lock is held, which lets readers of large
+// objects validate an unlocked copy (seqlock).
+struct alignas(64) HostSpaceAtomicLock {
+  unsigned sequence;
+  uint64_t acquisitions;  // Updated while holding the lock
+};
+
+// Counters updated by threads that do not hold the lock.  They live apart
+// from the locks so that counting a failed attempt does not write to the
+// line the waiting threads are spinning on, and are padded to a cache line
+// so that threads counting on neighbouring locks do not share a line.
+struct alignas(64) HostSpaceAtomicLockContention {
+  uint64_t contended;     // Failed lock attempts, updated atomically
+  uint64_t read_retries;  // Failed optimistic reads, updated atomically
+};
+
+const unsigned HOST_SPACE_ATOMIC_MASK          = 0xFFFF;
+const unsigned HOST_SPACE_ATOMIC_BACKOFF_LIMIT = 10;
+
+static HostSpaceAtomicLock HOST_SPACE_ATOMIC_LOCKS[HOST_SPACE_ATOMIC_MASK + 1];
+static HostSpaceAtomicLockContention
+    HOST_SPACE_ATOMIC_CONTENTION[HOST_SPACE_ATOMIC_MASK + 1];
+
+// Consecutive failed lock attempts of the calling thread
+static thread_local unsigned host_space_atomic_backoff = 0;
+
+// Mix all address bits into the index so that objects aligned to 16 bytes
+// or more still spread over the whole table.
+unsigned host_space_atomic_lock_index(void *ptr) {
+  uint64_t hash = uint64_t(size_t(ptr)) >> 2;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  return unsigned(hash) & HOST_SPACE_ATOMIC_MASK;
+}
+
+HostSpaceAtomicLock &host_space_atomic_lock(void *ptr) {
+  return HOST_SPACE_ATOMIC_LOCKS[host_space_atomic_lock_index(ptr)];
+}
+
+HostSpaceAtomicLockContention &host_space_atomic_contention(void *ptr) {
+  return HOST_SPACE_ATOMIC_CONTENTION[host_space_atomic_lock_index(ptr)];
+}
+
+// Spin for 2^n pauses after the n-th consecutive failure, then yield.
+void host_space_atomic_lock_backoff() {
+  const unsigned n = host_space_atomic_backoff;
+  if (n < HOST_SPACE_ATOMIC_BACKOFF_LIMIT) {
+    for (unsigned k = 0; k < (1u << n); ++k) {
+      Impl::host_thread_yield(1, Impl::WaitMode::ROOT);
+    }
+    host_space_atomic_backoff = n + 1;
+  } else {
+    Impl::host_thread_yield(1u << n, Impl::WaitMode::PASSIVE);
+  }
+}
+
 }  // namespace
 
 namespace Impl {
 void init_lock_array_host_space() {
-  static int is_initialized = 0;
-  if (!is_initialized)
-    for (int i = 0; i < static_cast<int>(HOST_SPACE_ATOMIC_MASK + 1); i++)
-      HOST_SPACE_ATOMIC_LOCKS[i] = 0;
+  static bool is_initialized = false;
+  if (!is_initialized) {
+    for (unsigned i = 0; i <= HOST_SPACE_ATOMIC_MASK; ++i) {
+      HOST_SPACE_ATOMIC_LOCKS[i].sequence = 0;
+    }
+    is_initialized = true;
+  }
 }
 
 bool lock_address_host_space(void *ptr) {
+  HostSpaceAtomicLock &lock = host_space_atomic_lock(ptr);
 #if defined(KOKKOS_ENABLE_ISA_X86_64) && defined(KOKKOS_ENABLE_TM) && \
     !defined(KOKKOS_COMPILER_PGI)
   const unsigned status = _xbegin();
 
   if (_XBEGIN_STARTED == status) {
-    const int val =
-        HOST_SPACE_ATOMIC_LOCKS[((size_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                                HOST_SPACE_ATOMIC_XOR_MASK];
+    const unsigned sequence = lock.sequence;
 
-    if (0 == val) {
-      HOST_SPACE_ATOMIC_LOCKS[((size_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                              HOST_SPACE_ATOMIC_XOR_MASK] = 1;
+    if (0 == (sequence & 1u)) {
+      lock.sequence = sequence + 1;
     } else {
       _xabort(1);
     }
 
     _xend();
 
+    ++lock.acquisitions;
+    host_space_atomic_backoff = 0;
     return 1;
   } else {
 #endif
-    return 0 == atomic_compare_exchange(
-                    &HOST_SPACE_ATOMIC_LOCKS[((size_t(ptr) >> 2) &
-                                              HOST_SPACE_ATOMIC_MASK) ^
-                                             HOST_SPACE_ATOMIC_XOR_MASK],
-                    0, 1);
+    // Test before compare-exchange so that waiting threads only read the
+    // lock's cache line.
+    const unsigned sequence =
+        *static_cast<volatile unsigned *>(&lock.sequence);
+    if (0 == (sequence & 1u) &&
+        sequence ==
+            atomic_compare_exchange(&lock.sequence, sequence, sequence + 1)) {
+      ++lock.acquisitions;
+      host_space_atomic_backoff = 0;
+      return 1;
+    }
+    atomic_increment(&host_space_atomic_contention(ptr).contended);
+    host_space_atomic_lock_backoff();
+    return 0;
 #if defined(KOKKOS_ENABLE_ISA_X86_64) && defined(KOKKOS_ENABLE_TM) && \
     !defined(KOKKOS_COMPILER_PGI)
   }
@@ -547,24 +616,70 @@ bool lock_address_host_space(void *ptr) {
 }
 
 void unlock_address_host_space(void *ptr) {
+  HostSpaceAtomicLock &lock = host_space_atomic_lock(ptr);
 #if defined(KOKKOS_ENABLE_ISA_X86_64) && defined(KOKKOS_ENABLE_TM) && \
     !defined(KOKKOS_COMPILER_PGI)
   const unsigned status = _xbegin();
 
   if (_XBEGIN_STARTED == status) {
-    HOST_SPACE_ATOMIC_LOCKS[((size_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                            HOST_SPACE_ATOMIC_XOR_MASK] = 0;
+    lock.sequence = lock.sequence + 1;
   } else {
 #endif
-    atomic_exchange(
-        &HOST_SPACE_ATOMIC_LOCKS[((size_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                                 HOST_SPACE_ATOMIC_XOR_MASK],
-        0);
+    atomic_exchange(&lock.sequence, lock.sequence + 1);
 #if defined(KOKKOS_ENABLE_ISA_X86_64) && defined(KOKKOS_ENABLE_TM) && \
     !defined(KOKKOS_COMPILER_PGI)
   }
 #endif
 }
 
+unsigned begin_read_address_host_space(void *ptr) {
+  HostSpaceAtomicLock &lock = host_space_atomic_lock(ptr);
+  unsigned sequence;
+  uint32_t i = 0;
+  while ((sequence = *static_cast<volatile unsigned *>(&lock.sequence)) & 1u) {
+    host_thread_yield(++i, WaitMode::ACTIVE);
+  }
+  Kokkos::load_fence();
+  return sequence;
+}
+
+bool validate_read_address_host_space(void *ptr, unsigned sequence) {
+  HostSpaceAtomicLock &lock = host_space_atomic_lock(ptr);
+  Kokkos::load_fence();
+  if (sequence == *static_cast<volatile unsigned *>(&lock.sequence)) {
+    return true;
+  }
+  atomic_increment(&host_space_atomic_contention(ptr).read_retries);
+  return false;
+}
+
 }  // namespace Impl
+
+namespace Tools {
+namespace Experimental {
+
+HostAtomicLockStatistics get_host_atomic_lock_statistics() {
+  HostAtomicLockStatistics statistics{HOST_SPACE_ATOMIC_MASK + 1, 0, 0, 0, 0};
+  for (unsigned i = 0; i <= HOST_SPACE_ATOMIC_MASK; ++i) {
+    const HostSpaceAtomicLockContention &contention =
+        HOST_SPACE_ATOMIC_CONTENTION[i];
+    statistics.acquisitions += HOST_SPACE_ATOMIC_LOCKS[i].acquisitions;
+    statistics.contended += contention.contended;
+    statistics.read_retries += contention.read_retries;
+    statistics.max_lock_contended =
+        std::max(statistics.max_lock_contended, contention.contended);
+  }
+  return statistics;
+}
+
+void reset_host_atomic_lock_statistics() {
+  for (unsigned i = 0; i <= HOST_SPACE_ATOMIC_MASK; ++i) {
+    HOST_SPACE_ATOMIC_LOCKS[i].acquisitions      = 0;
+    HOST_SPACE_ATOMIC_CONTENTION[i].contended    = 0;
+    HOST_SPACE_ATOMIC_CONTENTION[i].read_retries = 0;
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Tools
 }  // namespace Kokkos
@@ -53,8 +53,20 @@
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_HostBarrier.hpp>
 
-#include <limits>     // std::numeric_limits
-#include <algorithm>  // std::max
+#include <limits>       // std::numeric_limits
+#include <algorithm>    // std::max
+#include <type_traits>  // std::is_arithmetic
+
+// ThreadVectorRange iterations are independent by contract (they execute
+// concurrently on GPUs), so host vector-lane loops are handed to the
+// compiler's vectorizer with 'omp simd' whenever OpenMP 4.0 directives are
+// understood: in OpenMP builds, or with -fopenmp-simd when the build sets
+// KOKKOS_ENABLE_OPENMP_SIMD.  Note that an 'omp simd' sum reduction may
+// reorder floating point additions.
+#if (defined(_OPENMP) && (_OPENMP >= 201307)) || \
+    defined(KOKKOS_ENABLE_OPENMP_SIMD)
+#define KOKKOS_IMPL_HOST_VECTOR_OMP_SIMD
+#endif
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -849,7 +861,9 @@ KOKKOS_INLINE_FUNCTION void parallel_for(
     Closure const& closure,
     typename std::enable_if<Impl::is_host_thread_team_member<Member>::value>::
         type const** = nullptr) {
-#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#if defined(KOKKOS_IMPL_HOST_VECTOR_OMP_SIMD)
+#pragma omp simd
+#elif defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
 #pragma ivdep
 #endif
   for (iType i = loop_boundaries.start; i < loop_boundaries.end;
@@ -924,12 +938,74 @@ Impl::TeamThreadRangeBoundariesStruct<iType,Impl::HostThreadTeamMember<Space> >
 }*/
 
 //----------------------------------------------------------------------------
+
+namespace Impl {
+
+/// Number of partial results a host vector-lane reduction keeps: one per
+/// lane of a 64 byte vector register, so that each lane accumulates
+/// independently and the reducer's join runs only once per lane at the
+/// end rather than forming a dependency chain through every iteration.
+template <class ValueType>
+struct HostVectorReduceLanes {
+  enum : int {
+    value = sizeof(ValueType) >= 64
+                ? 1
+                : (64 / sizeof(ValueType) > 16 ? 16 : 64 / sizeof(ValueType))
+  };
+};
+
+/// Summation of an arithmetic type keeps one partial sum per lane, like
+/// the reducer overload below.  An 'omp simd reduction' clause would be
+/// shorter, but compilers keep its private copies in memory when the
+/// closure takes the value by reference, which is slower than the lanes.
+template <typename iType, class Lambda, typename ValueType, typename Member>
+KOKKOS_INLINE_FUNCTION void host_vector_reduce_sum(
+    const ThreadVectorRangeBoundariesStruct<iType, Member>& loop_boundaries,
+    const Lambda& lambda, ValueType& result, std::true_type) {
+  enum : int { lanes = HostVectorReduceLanes<ValueType>::value };
+
+  ValueType partial[lanes];
+  for (int lane = 0; lane < lanes; ++lane) partial[lane] = ValueType();
+
+  iType i = loop_boundaries.start;
+  for (; i < loop_boundaries.end && loop_boundaries.end - i >= iType(lanes);
+       i += iType(lanes)) {
+#if defined(KOKKOS_IMPL_HOST_VECTOR_OMP_SIMD)
+#pragma omp simd
+#endif
+    for (int lane = 0; lane < lanes; ++lane) {
+      lambda(i + iType(lane), partial[lane]);
+    }
+  }
+  for (; i < loop_boundaries.end; i += loop_boundaries.increment) {
+    lambda(i, partial[0]);
+  }
+
+  for (int lane = 1; lane < lanes; ++lane) partial[0] += partial[lane];
+  result = partial[0];
+}
+
+/// Other value types only promise value-initialization and +=, so they
+/// accumulate in order.
+template <typename iType, class Lambda, typename ValueType, typename Member>
+KOKKOS_INLINE_FUNCTION void host_vector_reduce_sum(
+    const ThreadVectorRangeBoundariesStruct<iType, Member>& loop_boundaries,
+    const Lambda& lambda, ValueType& result, std::false_type) {
+  result = ValueType();
+  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
+       i += loop_boundaries.increment) {
+    lambda(i, result);
+  }
+}
+
+}  // namespace Impl
+
 /** \brief  Inter-thread vector parallel_reduce.
  *
  *  Executes lambda(iType i, ValueType & val) for each i=[0..N)
  *
- *  The range [0..N) is mapped to all threads of the
- *  calling thread team and a summation of  val is
+ *  The range [0..N) is mapped to all vector lanes of the
+ *  calling thread and a summation of  val is
  *  performed and put into result.
  */
 template <typename iType, class Lambda, typename ValueType, typename Member>
@@ -939,13 +1015,18 @@ KOKKOS_INLINE_FUNCTION typename std::enable_if<
 parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<iType, Member>&
                     loop_boundaries,
                 const Lambda& lambda, ValueType& result) {
-  result = ValueType();
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, result);
-  }
+  Impl::host_vector_reduce_sum(
+      loop_boundaries, lambda, result,
+      std::integral_constant<bool, std::is_arithmetic<ValueType>::value>());
 }
 
+/** \brief  Inter-thread vector parallel_reduce with a reducer.
+ *
+ *  Iteration i accumulates into partial result i % L, where L is
+ *  Impl::HostVectorReduceLanes, so that the L lanes of each block of
+ *  iterations are independent and vectorize for any reducer.  The
+ *  partial results are joined when the range is done.
+ */
 template <typename iType, class Lambda, typename ReducerType, typename Member>
 KOKKOS_INLINE_FUNCTION typename std::enable_if<
     Kokkos::is_reducer<ReducerType>::value &&
@@ -953,11 +1034,30 @@ KOKKOS_INLINE_FUNCTION typename std::enable_if<
 parallel_reduce(const Impl::ThreadVectorRangeBoundariesStruct<iType, Member>&
                     loop_boundaries,
                 const Lambda& lambda, const ReducerType& reducer) {
-  reducer.init(reducer.reference());
-  for (iType i = loop_boundaries.start; i < loop_boundaries.end;
-       i += loop_boundaries.increment) {
-    lambda(i, reducer.reference());
+  using value_type = typename ReducerType::value_type;
+  enum : int { lanes = Impl::HostVectorReduceLanes<value_type>::value };
+
+  value_type partial[lanes];
+  for (int lane = 0; lane < lanes; ++lane) reducer.init(partial[lane]);
+
+  iType i = loop_boundaries.start;
+  for (; i < loop_boundaries.end && loop_boundaries.end - i >= iType(lanes);
+       i += iType(lanes)) {
+#if defined(KOKKOS_IMPL_HOST_VECTOR_OMP_SIMD)
+#pragma omp simd
+#endif
+    for (int lane = 0; lane < lanes; ++lane) {
+      lambda(i + iType(lane), partial[lane]);
+    }
+  }
+  for (; i < loop_boundaries.end; i += loop_boundaries.increment) {
+    lambda(i, partial[0]);
+  }
+
+  for (int lane = 1; lane < lanes; ++lane) {
+    reducer.join(partial[0], partial[lane]);
   }
+  reducer.reference() = partial[0];
 }
 
 //----------------------------------------------------------------------------
@@ -57,6 +57,8 @@
 #include <array>
 #include <stack>
 #include <iostream>
+#include <fstream>
+#include <sstream>
 namespace Kokkos {
 
 namespace Tools {
@@ -329,6 +331,11 @@ void initialize() {
   if (is_initialized) return;
   is_initialized = 1;
 
+  const char* tile_cache_file = getenv("KOKKOS_TILE_CACHE_FILE");
+  if (tile_cache_file != nullptr) {
+    Experimental::load_mdrange_tile_cache(tile_cache_file);
+  }
+
 #ifdef KOKKOS_ENABLE_LIBDL
   void* firstProfileLibrary = nullptr;
 
@@ -547,6 +554,11 @@ void finalize() {
   if (is_finalized) return;
   is_finalized = 1;
 
+  const char* tile_cache_file = getenv("KOKKOS_TILE_CACHE_FILE");
+  if (tile_cache_file != nullptr) {
+    Experimental::save_mdrange_tile_cache(tile_cache_file);
+  }
+
   if (Experimental::current_callbacks.finalize != nullptr) {
     (*Experimental::current_callbacks.finalize)();
 
@@ -963,6 +975,139 @@ void declare_optimization_goal(const size_t context,
   (void)goal;
 #endif
 }
+
+constexpr int64_t MDRangeTileSearch::max_tile_points;
+constexpr int MDRangeTileSearch::samples_per_trial;
+constexpr double MDRangeTileSearch::min_improvement;
+
+MDRangeTileSearch::MDRangeTileSearch(tile_type best)
+    : m_best(std::move(best)), m_converged(true) {}
+
+MDRangeTileSearch::MDRangeTileSearch(tile_type initial,
+                                     const candidate_type& candidates,
+                                     bool inner_right)
+    : m_best(std::move(initial)) {
+  const size_t rank = candidates.size();
+  for (size_t i = 0; i < rank; ++i) {
+    const size_t dim = inner_right ? rank - 1 - i : i;
+    for (auto extent : candidates[dim]) m_moves.emplace_back(dim, extent);
+  }
+  m_trial = m_best;
+}
+
+void MDRangeTileSearch::end_trial(const tile_type& tile, double seconds) {
+  if (m_converged || tile != m_trial) return;
+  if (!m_warmed_up) {
+    m_warmed_up = true;
+    return;
+  }
+  m_trial_time =
+      m_num_samples == 0 ? seconds : std::min(m_trial_time, seconds);
+  if (++m_num_samples < samples_per_trial) return;
+  m_num_samples = 0;
+  if (m_best_time < 0.0) {  // the starting tile
+    m_best_time = m_trial_time;
+  } else {
+    if (m_trial_time < (1.0 - min_improvement) * m_best_time) {
+      m_best_time = m_trial_time;
+      m_best      = m_trial;
+    }
+    ++m_next_move;
+  }
+  advance();
+}
+
+// Move on to the next candidate that changes the best tile and still fits
+// in cache; the search has converged once no such candidate is left.
+void MDRangeTileSearch::advance() {
+  for (; m_next_move < m_moves.size(); ++m_next_move) {
+    const auto& move = m_moves[m_next_move];
+    if (m_best[move.first] == move.second) continue;
+    m_trial             = m_best;
+    m_trial[move.first] = move.second;
+    int64_t tile_points = 1;
+    for (auto extent : m_trial) tile_points *= extent;
+    if (tile_points <= max_tile_points) return;
+  }
+  m_trial     = m_best;
+  m_converged = true;
+}
+
+std::map<std::string, MDRangeTileSearch>& mdrange_tile_searches() {
+  static std::map<std::string, MDRangeTileSearch> searches;
+  return searches;
+}
+
+std::mutex& mdrange_tile_search_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// One line per learned tile: the rank, the tile extents and the kernel key
+void load_mdrange_tile_cache(const std::string& filename) {
+  std::ifstream in(filename);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    size_t rank = 0;
+    fields >> rank;
+    MDRangeTileSearch::tile_type tile(rank);
+    for (auto& extent : tile) fields >> extent;
+    std::string key;
+    if (rank == 0 || !std::getline(fields >> std::ws, key)) continue;
+    std::lock_guard<std::mutex> lock(mdrange_tile_search_mutex());
+    mdrange_tile_searches()[key] = MDRangeTileSearch(tile);
+  }
+}
+
+void save_mdrange_tile_cache(const std::string& filename) {
+  std::ofstream out(filename);
+  if (!out) {
+    std::cerr << "Kokkos::Tools::Experimental::save_mdrange_tile_cache: "
+              << "could not open " << filename << std::endl;
+    return;
+  }
+  out << "# Kokkos MDRangePolicy tile cache: rank, tile, kernel\n";
+  std::lock_guard<std::mutex> lock(mdrange_tile_search_mutex());
+  for (const auto& entry : mdrange_tile_searches()) {
+    if (!entry.second.converged()) continue;
+    const auto& tile = entry.second.best();
+    out << tile.size();
+    for (auto extent : tile) out << ' ' << extent;
+    out << ' ' << entry.first << '\n';
+  }
+}
+
+namespace Impl {
+
+MDRangeTileSearch::candidate_type mdrange_tile_candidates(
+    const std::vector<int64_t>& span, bool inner_right) {
+  const size_t rank = span.size();
+  MDRangeTileSearch::candidate_type candidates(rank);
+  for (size_t dim = 0; dim < rank; ++dim) {
+    // Distance from the fastest-striding dimension
+    const size_t level   = inner_right ? rank - 1 - dim : dim;
+    const int64_t extent = std::max<int64_t>(span[dim], 1);
+    auto& extents        = candidates[dim];
+    if (level == 0) {
+      extents.push_back(extent);
+      for (int64_t block : {512, 128, 32}) {
+        if (block < extent) extents.push_back(block);
+      }
+    } else {
+      const int64_t max_block = level == 1 ? 64 : 8;
+      for (int64_t block = 1; block <= max_block && block < extent;
+           block *= 2) {
+        extents.push_back(block);
+      }
+      if (extent <= max_block) extents.push_back(extent);
+    }
+  }
+  return candidates;
+}
+
+}  // namespace Impl
 }  // end namespace Experimental
 }  // end namespace Tools
 
@@ -53,6 +53,8 @@
 #include <string>
 #include <map>
 #include <type_traits>
+#include <chrono>
+#include <mutex>
 namespace Kokkos {
 
 // forward declaration
@@ -360,6 +362,173 @@ void report_policy_results(const size_t /**tuning_context*/,
   }
 }
 
+/**
+ * Tile tuning for MDRangePolicy is opt-in (MDRangePolicy::set_tile_tuning)
+ * and, unlike team size tuning, also works without a tuning tool: the
+ * built-in MDRangeTileSearch times candidate tiles across launches of the
+ * same kernel.  Only host-accessible execution spaces are tuned.
+ */
+template <class ExecPolicy, class Functor>
+void begin_tile_tuning(const std::string&, ExecPolicy&, const Functor&) {}
+
+template <class ExecPolicy, class Functor>
+void end_tile_tuning(const std::string&, const ExecPolicy&, const Functor&) {}
+
+template <class Functor, class... Properties>
+std::string mdrange_tuning_key(
+    const std::string& label_in,
+    const Kokkos::MDRangePolicy<Properties...>& policy) {
+  using policy_type = Kokkos::MDRangePolicy<Properties...>;
+  std::string label = label_in;
+  if (label_in.empty()) {
+    Kokkos::Impl::ParallelConstructName<Functor, typename policy_type::work_tag>
+        name(label);
+    label = name.get();
+  }
+  label += " [";
+  for (int i = 0; i < policy_type::rank; ++i) {
+    label += (i == 0 ? "" : "x") +
+             std::to_string(policy.m_upper[i] - policy.m_lower[i]);
+  }
+  return label + "]";
+}
+
+template <int Rank>
+std::map<std::string, Kokkos::Tools::Experimental::MDRangeTuner<Rank>>&
+mdrange_tuners() {
+  static std::map<std::string, Kokkos::Tools::Experimental::MDRangeTuner<Rank>>
+      tuners;
+  return tuners;
+}
+
+template <class... Properties>
+bool use_tile_tuning(const Kokkos::MDRangePolicy<Properties...>& policy) {
+  using memory_space = typename Kokkos::MDRangePolicy<
+      Properties...>::traits::execution_space::memory_space;
+  return policy.impl_tune_tile_size() &&
+         Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                         memory_space>::accessible;
+}
+
+inline bool use_tile_tuning_tool() {
+  return Kokkos::tune_internals() &&
+         Kokkos::Tools::Experimental::have_tuning_tool();
+}
+
+// The tile tuning started by begin_tile_tuning on this thread, finished by
+// the matching end_tile_tuning
+struct MDRangeTileTrial {
+  std::string key;  // empty when there is nothing to finish
+  bool tool = false;
+  Kokkos::Tools::Experimental::MDRangeTileSearch::tile_type tile;
+  std::chrono::steady_clock::time_point start;
+};
+
+inline MDRangeTileTrial& current_mdrange_tile_trial() {
+  static thread_local MDRangeTileTrial trial;
+  return trial;
+}
+
+template <class Functor, class... Properties>
+void begin_tile_tuning(const std::string& label,
+                       Kokkos::MDRangePolicy<Properties...>& policy,
+                       const Functor&) {
+  using policy_type = Kokkos::MDRangePolicy<Properties...>;
+  using Kokkos::Tools::Experimental::MDRangeTileSearch;
+  if (!use_tile_tuning(policy)) return;
+
+  MDRangeTileTrial& trial = current_mdrange_tile_trial();
+  trial.key               = mdrange_tuning_key<Functor>(label, policy);
+  trial.tool              = use_tile_tuning_tool();
+  MDRangeTileSearch::tile_type span, initial;
+  for (int i = 0; i < policy_type::rank; ++i) {
+    span.push_back(policy.m_upper[i] - policy.m_lower[i]);
+    initial.push_back(policy.m_tile[i]);
+  }
+  const bool inner_right = policy_type::inner_direction == policy_type::Right;
+
+  std::unique_lock<std::mutex> lock(
+      Kokkos::Tools::Experimental::mdrange_tile_search_mutex());
+  if (trial.tool) {
+    auto& tuners    = mdrange_tuners<policy_type::rank>();
+    auto tuner_iter = tuners.find(trial.key);
+    if (tuner_iter == tuners.end()) {
+      tuner_iter =
+          tuners
+              .emplace(trial.key,
+                       Kokkos::Tools::Experimental::MDRangeTuner<
+                           policy_type::rank>(
+                           trial.key, Kokkos::Tools::Experimental::Impl::
+                                          mdrange_tile_candidates(
+                                              span, inner_right)))
+              .first;
+    }
+    tuner_iter->second.tune(policy);
+    return;
+  }
+
+  auto& searches   = Kokkos::Tools::Experimental::mdrange_tile_searches();
+  auto search_iter = searches.find(trial.key);
+  if (search_iter == searches.end()) {
+    search_iter =
+        searches
+            .emplace(trial.key,
+                     MDRangeTileSearch(
+                         initial,
+                         Kokkos::Tools::Experimental::Impl::
+                             mdrange_tile_candidates(span, inner_right),
+                         inner_right))
+            .first;
+  }
+  trial.tile           = search_iter->second.begin_trial();
+  const bool searching = !search_iter->second.converged();
+  lock.unlock();
+
+  // Converged searches only hand out the learned tile
+  if (!searching) trial.key.clear();
+  if (trial.tile.size() != static_cast<size_t>(policy_type::rank)) {
+    trial.key.clear();
+    return;
+  }
+  typename policy_type::tile_type new_tile;
+  for (int i = 0; i < policy_type::rank; ++i) new_tile[i] = trial.tile[i];
+  policy.impl_change_tile_size(new_tile);
+  if (searching) {
+    // Keep earlier work of asynchronous backends out of the measurement
+    policy.space().fence();
+    trial.start = std::chrono::steady_clock::now();
+  }
+}
+
+template <class Functor, class... Properties>
+void end_tile_tuning(const std::string&,
+                     const Kokkos::MDRangePolicy<Properties...>& policy,
+                     const Functor&) {
+  using policy_type = Kokkos::MDRangePolicy<Properties...>;
+  if (!use_tile_tuning(policy)) return;
+  MDRangeTileTrial& trial = current_mdrange_tile_trial();
+  if (trial.key.empty()) return;
+
+  if (trial.tool) {
+    std::lock_guard<std::mutex> lock(
+        Kokkos::Tools::Experimental::mdrange_tile_search_mutex());
+    mdrange_tuners<policy_type::rank>()[trial.key].end();
+  } else {
+    policy.space().fence();
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - trial.start)
+                               .count();
+    std::lock_guard<std::mutex> lock(
+        Kokkos::Tools::Experimental::mdrange_tile_search_mutex());
+    auto& searches   = Kokkos::Tools::Experimental::mdrange_tile_searches();
+    auto search_iter = searches.find(trial.key);
+    if (search_iter != searches.end()) {
+      search_iter->second.end_trial(trial.tile, seconds);
+    }
+  }
+  trial.key.clear();
+}
+
 template <class ExecPolicy, class FunctorType>
 void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
                         const std::string& label, uint64_t& kpID) {
@@ -371,13 +540,12 @@ void begin_parallel_for(ExecPolicy& policy, FunctorType& functor,
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
   }
+  begin_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
     tune_policy(context_id, label, policy, functor, Kokkos::ParallelForTag{});
   }
-#else
-  (void)functor;
 #endif
 }
 
@@ -387,16 +555,13 @@ void end_parallel_for(ExecPolicy& policy, FunctorType& functor,
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelFor(kpID);
   }
+  end_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelForTag{});
   }
-#else
-  (void)policy;
-  (void)functor;
-  (void)label;
 #endif
 }
 
@@ -411,13 +576,12 @@ void begin_parallel_scan(ExecPolicy& policy, FunctorType& functor,
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
   }
+  begin_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   if (Kokkos::tune_internals()) {
     tune_policy(context_id, label, policy, functor, Kokkos::ParallelScanTag{});
   }
-#else
-  (void)functor;
 #endif
 }
 
@@ -427,16 +591,13 @@ void end_parallel_scan(ExecPolicy& policy, FunctorType& functor,
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelScan(kpID);
   }
+  end_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelScanTag{});
   }
-#else
-  (void)policy;
-  (void)functor;
-  (void)label;
 #endif
 }
 
@@ -451,12 +612,11 @@ void begin_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
   }
+  begin_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_new_context_id();
   ReductionSwitcher<ReducerType>::tune(context_id, label, policy, functor,
                                        Kokkos::ParallelReduceTag{});
-#else
-  (void)functor;
 #endif
 }
 
@@ -466,16 +626,13 @@ void end_parallel_reduce(ExecPolicy& policy, FunctorType& functor,
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelReduce(kpID);
   }
+  end_tile_tuning(label, policy, functor);
 #ifdef KOKKOS_ENABLE_TUNING
   size_t context_id = Kokkos::Tools::Experimental::get_current_context_id();
   if (Kokkos::tune_internals()) {
     report_policy_results(context_id, label, policy, functor,
                           Kokkos::ParallelReduceTag{});
   }
-#else
-  (void)policy;
-  (void)functor;
-  (void)label;
 #endif
 }
 
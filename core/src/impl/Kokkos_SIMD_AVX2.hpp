@@ -0,0 +1,711 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX2_HPP
+#define KOKKOS_SIMD_AVX2_HPP
+
+// AVX2 specializations of simd and simd_mask for 4 double and 8 float
+// lanes.  Included by Kokkos_SIMD.hpp when the compiler targets AVX2.
+
+#include <immintrin.h>
+
+namespace Kokkos {
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+// double, 4 lanes
+
+template <>
+class simd_mask<double, simd_abi::avx2_fixed_size<4> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using simd_type  = simd<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(_mm256_castsi256_pd(_mm256_set1_epi64x(-std::int64_t(value)))) {
+  }
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen)
+      : m_value(_mm256_castsi256_pd(_mm256_setr_epi64x(
+            -std::int64_t(bool(gen(std::size_t(0)))),
+            -std::int64_t(bool(gen(std::size_t(1)))),
+            -std::int64_t(bool(gen(std::size_t(2)))),
+            -std::int64_t(bool(gen(std::size_t(3))))))) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(__m256d const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m256d() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    return (_mm256_movemask_pd(m_value) >> i) & 1;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_and_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_or_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(_mm256_xor_pd(m_value, simd_mask(true).m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return !(a != b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_xor_pd(a.m_value, b.m_value));
+  }
+
+ private:
+  __m256d m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask) {
+  return _mm256_movemask_pd(static_cast<__m256d>(mask)) == 0xF;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask) {
+  return _mm256_movemask_pd(static_cast<__m256d>(mask)) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask) {
+  return _mm256_movemask_pd(static_cast<__m256d>(mask)) == 0;
+}
+
+template <>
+class simd<double, simd_abi::avx2_fixed_size<4> > {
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_pd(double(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm256_setr_pd(gen(std::size_t(0)), gen(std::size_t(1)),
+                               gen(std::size_t(2)), gen(std::size_t(3)))) {}
+
+  template <class U, typename std::enable_if<!std::is_same<U, double>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return double(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(__m256d const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m256d() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  element_aligned_tag) {
+    m_value = _mm256_loadu_pd(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = _mm256_load_pd(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                element_aligned_tag) const {
+    _mm256_storeu_pd(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                vector_aligned_tag) const {
+    _mm256_store_pd(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION double operator[](std::size_t i) const {
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_xor_pd(m_value, _mm256_set1_pd(-0.0)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_add_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_sub_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_mul_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_div_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_EQ_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_NEQ_UQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_LT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_LE_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_GT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_pd(a.m_value, b.m_value, _CMP_GE_OQ));
+  }
+
+ private:
+  __m256d m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+condition(simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask,
+          simd<double, simd_abi::avx2_fixed_size<4> > const& a,
+          simd<double, simd_abi::avx2_fixed_size<4> > const& b) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_blendv_pd(static_cast<__m256d>(b), static_cast<__m256d>(a),
+                       static_cast<__m256d>(mask)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+abs(simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_andnot_pd(_mm256_set1_pd(-0.0), static_cast<__m256d>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+sqrt(simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_sqrt_pd(static_cast<__m256d>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+floor(simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_floor_pd(static_cast<__m256d>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+ceil(simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_ceil_pd(static_cast<__m256d>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+trunc(simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(_mm256_round_pd(
+      static_cast<__m256d>(x), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+copysign(simd<double, simd_abi::avx2_fixed_size<4> > const& a,
+         simd<double, simd_abi::avx2_fixed_size<4> > const& b) {
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_or_pd(_mm256_andnot_pd(sign_mask, static_cast<__m256d>(a)),
+                   _mm256_and_pd(sign_mask, static_cast<__m256d>(b))));
+}
+
+#if defined(__FMA__)
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+fma(simd<double, simd_abi::avx2_fixed_size<4> > const& a,
+    simd<double, simd_abi::avx2_fixed_size<4> > const& b,
+    simd<double, simd_abi::avx2_fixed_size<4> > const& c) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_fmadd_pd(static_cast<__m256d>(a), static_cast<__m256d>(b),
+                      static_cast<__m256d>(c)));
+}
+#endif
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+min(simd<double, simd_abi::avx2_fixed_size<4> > const& a,
+    simd<double, simd_abi::avx2_fixed_size<4> > const& b) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_min_pd(static_cast<__m256d>(b), static_cast<__m256d>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx2_fixed_size<4> >
+max(simd<double, simd_abi::avx2_fixed_size<4> > const& a,
+    simd<double, simd_abi::avx2_fixed_size<4> > const& b) {
+  return simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_max_pd(static_cast<__m256d>(b), static_cast<__m256d>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::avx2_fixed_size<4> > const& x) {
+  const __m256d v = static_cast<__m256d>(x);
+  __m128d sum     = _mm_add_pd(_mm256_castpd256_pd128(v),
+                           _mm256_extractf128_pd(v, 1));
+  sum = _mm_add_sd(sum, _mm_unpackhi_pd(sum, sum));
+  return _mm_cvtsd_f64(sum);
+}
+
+namespace Impl {
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_from(
+    simd<double, simd_abi::avx2_fixed_size<4> >& value,
+    simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask,
+    double const* ptr) {
+  const __m256d m = static_cast<__m256d>(mask);
+  value           = simd<double, simd_abi::avx2_fixed_size<4> >(
+      _mm256_blendv_pd(static_cast<__m256d>(value),
+                       _mm256_maskload_pd(ptr, _mm256_castpd_si256(m)), m));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_to(
+    simd<double, simd_abi::avx2_fixed_size<4> > const& value,
+    simd_mask<double, simd_abi::avx2_fixed_size<4> > const& mask,
+    double* ptr) {
+  _mm256_maskstore_pd(ptr, _mm256_castpd_si256(static_cast<__m256d>(mask)),
+                      static_cast<__m256d>(value));
+}
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+// float, 8 lanes
+
+template <>
+class simd_mask<float, simd_abi::avx2_fixed_size<8> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::avx2_fixed_size<8>;
+  using simd_type  = simd<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(_mm256_castsi256_ps(_mm256_set1_epi32(-std::int32_t(value)))) {
+  }
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen)
+      : m_value(_mm256_castsi256_ps(_mm256_setr_epi32(
+            -std::int32_t(bool(gen(std::size_t(0)))),
+            -std::int32_t(bool(gen(std::size_t(1)))),
+            -std::int32_t(bool(gen(std::size_t(2)))),
+            -std::int32_t(bool(gen(std::size_t(3)))),
+            -std::int32_t(bool(gen(std::size_t(4)))),
+            -std::int32_t(bool(gen(std::size_t(5)))),
+            -std::int32_t(bool(gen(std::size_t(6)))),
+            -std::int32_t(bool(gen(std::size_t(7))))))) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(__m256 const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m256() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    return (_mm256_movemask_ps(m_value) >> i) & 1;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_and_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_or_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(_mm256_xor_ps(m_value, simd_mask(true).m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return !(a != b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(_mm256_xor_ps(a.m_value, b.m_value));
+  }
+
+ private:
+  __m256 m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask) {
+  return _mm256_movemask_ps(static_cast<__m256>(mask)) == 0xFF;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask) {
+  return _mm256_movemask_ps(static_cast<__m256>(mask)) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask) {
+  return _mm256_movemask_ps(static_cast<__m256>(mask)) == 0;
+}
+
+template <>
+class simd<float, simd_abi::avx2_fixed_size<8> > {
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::avx2_fixed_size<8>;
+  using mask_type  = simd_mask<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_ps(float(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm256_setr_ps(gen(std::size_t(0)), gen(std::size_t(1)),
+                               gen(std::size_t(2)), gen(std::size_t(3)),
+                               gen(std::size_t(4)), gen(std::size_t(5)),
+                               gen(std::size_t(6)), gen(std::size_t(7)))) {}
+
+  template <class U, typename std::enable_if<!std::is_same<U, float>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return float(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(__m256 const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m256() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  element_aligned_tag) {
+    m_value = _mm256_loadu_ps(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = _mm256_load_ps(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                element_aligned_tag) const {
+    _mm256_storeu_ps(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                vector_aligned_tag) const {
+    _mm256_store_ps(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION float operator[](std::size_t i) const {
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_xor_ps(m_value, _mm256_set1_ps(-0.0f)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_add_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_sub_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_mul_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm256_div_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_EQ_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_NEQ_UQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_LT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_LE_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_GT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm256_cmp_ps(a.m_value, b.m_value, _CMP_GE_OQ));
+  }
+
+ private:
+  __m256 m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+condition(simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask,
+          simd<float, simd_abi::avx2_fixed_size<8> > const& a,
+          simd<float, simd_abi::avx2_fixed_size<8> > const& b) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_blendv_ps(static_cast<__m256>(b), static_cast<__m256>(a),
+                       static_cast<__m256>(mask)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+abs(simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_andnot_ps(_mm256_set1_ps(-0.0f), static_cast<__m256>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+sqrt(simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_sqrt_ps(static_cast<__m256>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+floor(simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_floor_ps(static_cast<__m256>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+ceil(simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_ceil_ps(static_cast<__m256>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+trunc(simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(_mm256_round_ps(
+      static_cast<__m256>(x), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+copysign(simd<float, simd_abi::avx2_fixed_size<8> > const& a,
+         simd<float, simd_abi::avx2_fixed_size<8> > const& b) {
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_or_ps(_mm256_andnot_ps(sign_mask, static_cast<__m256>(a)),
+                   _mm256_and_ps(sign_mask, static_cast<__m256>(b))));
+}
+
+#if defined(__FMA__)
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+fma(simd<float, simd_abi::avx2_fixed_size<8> > const& a,
+    simd<float, simd_abi::avx2_fixed_size<8> > const& b,
+    simd<float, simd_abi::avx2_fixed_size<8> > const& c) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_fmadd_ps(static_cast<__m256>(a), static_cast<__m256>(b),
+                      static_cast<__m256>(c)));
+}
+#endif
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+min(simd<float, simd_abi::avx2_fixed_size<8> > const& a,
+    simd<float, simd_abi::avx2_fixed_size<8> > const& b) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_min_ps(static_cast<__m256>(b), static_cast<__m256>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx2_fixed_size<8> >
+max(simd<float, simd_abi::avx2_fixed_size<8> > const& a,
+    simd<float, simd_abi::avx2_fixed_size<8> > const& b) {
+  return simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_max_ps(static_cast<__m256>(b), static_cast<__m256>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION float reduce(
+    simd<float, simd_abi::avx2_fixed_size<8> > const& x) {
+  const __m256 v = static_cast<__m256>(x);
+  __m128 sum =
+      _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+  return _mm_cvtss_f32(sum);
+}
+
+namespace Impl {
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_from(
+    simd<float, simd_abi::avx2_fixed_size<8> >& value,
+    simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask,
+    float const* ptr) {
+  const __m256 m = static_cast<__m256>(mask);
+  value          = simd<float, simd_abi::avx2_fixed_size<8> >(
+      _mm256_blendv_ps(static_cast<__m256>(value),
+                       _mm256_maskload_ps(ptr, _mm256_castps_si256(m)), m));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_to(
+    simd<float, simd_abi::avx2_fixed_size<8> > const& value,
+    simd_mask<float, simd_abi::avx2_fixed_size<8> > const& mask, float* ptr) {
+  _mm256_maskstore_ps(ptr, _mm256_castps_si256(static_cast<__m256>(mask)),
+                      static_cast<__m256>(value));
+}
+
+}  // namespace Impl
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* KOKKOS_SIMD_AVX2_HPP */
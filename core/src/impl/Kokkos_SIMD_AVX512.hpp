@@ -0,0 +1,723 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_AVX512_HPP
+#define KOKKOS_SIMD_AVX512_HPP
+
+// AVX-512 specializations of simd and simd_mask for 8 double and 16 float
+// lanes, using only AVX-512F instructions so they serve both Xeon and
+// Xeon Phi.  Included by Kokkos_SIMD.hpp when the compiler targets
+// AVX-512F.
+
+#include <immintrin.h>
+
+namespace Kokkos {
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+// double, 8 lanes
+
+template <>
+class simd_mask<double, simd_abi::avx512_fixed_size<8> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using simd_type  = simd<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(value ? 0xFF : 0) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) : m_value(0) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      if (gen(i)) m_value |= __mmask8(1u << i);
+    }
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(__mmask8 value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __mmask8() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    return (m_value >> i) & 1;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask8(a.m_value & b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask8(a.m_value | b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(__mmask8(~m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask8(~(a.m_value ^ b.m_value)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask8(a.m_value ^ b.m_value));
+  }
+
+ private:
+  __mmask8 m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask) {
+  return static_cast<__mmask8>(mask) == 0xFF;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask) {
+  return static_cast<__mmask8>(mask) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask) {
+  return static_cast<__mmask8>(mask) == 0;
+}
+
+template <>
+class simd<double, simd_abi::avx512_fixed_size<8> > {
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm512_set1_pd(double(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm512_setr_pd(gen(std::size_t(0)), gen(std::size_t(1)),
+                               gen(std::size_t(2)), gen(std::size_t(3)),
+                               gen(std::size_t(4)), gen(std::size_t(5)),
+                               gen(std::size_t(6)), gen(std::size_t(7)))) {}
+
+  template <class U, typename std::enable_if<!std::is_same<U, double>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return double(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(__m512d const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m512d() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  element_aligned_tag) {
+    m_value = _mm512_loadu_pd(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = _mm512_load_pd(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                element_aligned_tag) const {
+    _mm512_storeu_pd(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                vector_aligned_tag) const {
+    _mm512_store_pd(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION double operator[](std::size_t i) const {
+    alignas(64) double lanes[8];
+    _mm512_store_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm512_castsi512_pd(
+        _mm512_xor_si512(_mm512_castpd_si512(m_value),
+                         _mm512_set1_epi64(std::int64_t(1) << 63))));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_add_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_sub_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_mul_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_div_pd(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_EQ_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_NEQ_UQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_LT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_LE_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_GT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_pd_mask(a.m_value, b.m_value, _CMP_GE_OQ));
+  }
+
+ private:
+  __m512d m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+condition(simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask,
+          simd<double, simd_abi::avx512_fixed_size<8> > const& a,
+          simd<double, simd_abi::avx512_fixed_size<8> > const& b) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_mask_blend_pd(static_cast<__mmask8>(mask),
+                           static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+abs(simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(_mm512_castsi512_pd(
+      _mm512_and_si512(_mm512_castpd_si512(static_cast<__m512d>(x)),
+                       _mm512_set1_epi64(~(std::int64_t(1) << 63)))));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+sqrt(simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_sqrt_pd(static_cast<__m512d>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+floor(simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(_mm512_roundscale_pd(
+      static_cast<__m512d>(x), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+ceil(simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(_mm512_roundscale_pd(
+      static_cast<__m512d>(x), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+trunc(simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(_mm512_roundscale_pd(
+      static_cast<__m512d>(x), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+copysign(simd<double, simd_abi::avx512_fixed_size<8> > const& a,
+         simd<double, simd_abi::avx512_fixed_size<8> > const& b) {
+  const __m512i sign_mask = _mm512_set1_epi64(std::int64_t(1) << 63);
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_castsi512_pd(_mm512_or_si512(
+          _mm512_andnot_si512(sign_mask,
+                              _mm512_castpd_si512(static_cast<__m512d>(a))),
+          _mm512_and_si512(sign_mask,
+                           _mm512_castpd_si512(static_cast<__m512d>(b))))));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+fma(simd<double, simd_abi::avx512_fixed_size<8> > const& a,
+    simd<double, simd_abi::avx512_fixed_size<8> > const& b,
+    simd<double, simd_abi::avx512_fixed_size<8> > const& c) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_fmadd_pd(static_cast<__m512d>(a), static_cast<__m512d>(b),
+                      static_cast<__m512d>(c)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+min(simd<double, simd_abi::avx512_fixed_size<8> > const& a,
+    simd<double, simd_abi::avx512_fixed_size<8> > const& b) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_min_pd(static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::avx512_fixed_size<8> >
+max(simd<double, simd_abi::avx512_fixed_size<8> > const& a,
+    simd<double, simd_abi::avx512_fixed_size<8> > const& b) {
+  return simd<double, simd_abi::avx512_fixed_size<8> >(
+      _mm512_max_pd(static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return _mm512_reduce_add_pd(static_cast<__m512d>(x));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION double hmin(
+    simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return _mm512_reduce_min_pd(static_cast<__m512d>(x));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION double hmax(
+    simd<double, simd_abi::avx512_fixed_size<8> > const& x) {
+  return _mm512_reduce_max_pd(static_cast<__m512d>(x));
+}
+
+namespace Impl {
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_from(
+    simd<double, simd_abi::avx512_fixed_size<8> >& value,
+    simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask,
+    double const* ptr) {
+  value = simd<double, simd_abi::avx512_fixed_size<8> >(_mm512_mask_loadu_pd(
+      static_cast<__m512d>(value), static_cast<__mmask8>(mask), ptr));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_to(
+    simd<double, simd_abi::avx512_fixed_size<8> > const& value,
+    simd_mask<double, simd_abi::avx512_fixed_size<8> > const& mask,
+    double* ptr) {
+  _mm512_mask_storeu_pd(ptr, static_cast<__mmask8>(mask),
+                        static_cast<__m512d>(value));
+}
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+// float, 16 lanes
+
+template <>
+class simd_mask<float, simd_abi::avx512_fixed_size<16> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::avx512_fixed_size<16>;
+  using simd_type  = simd<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 16;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(value ? 0xFFFF : 0) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) : m_value(0) {
+    for (std::size_t i = 0; i < size(); ++i) {
+      if (gen(i)) m_value |= __mmask16(1u << i);
+    }
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(__mmask16 value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __mmask16() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    return (m_value >> i) & 1;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask16(a.m_value & b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask16(a.m_value | b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(__mmask16(~m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask16(~(a.m_value ^ b.m_value)));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(__mmask16(a.m_value ^ b.m_value));
+  }
+
+ private:
+  __mmask16 m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask) {
+  return static_cast<__mmask16>(mask) == 0xFFFF;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask) {
+  return static_cast<__mmask16>(mask) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask) {
+  return static_cast<__mmask16>(mask) == 0;
+}
+
+template <>
+class simd<float, simd_abi::avx512_fixed_size<16> > {
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::avx512_fixed_size<16>;
+  using mask_type  = simd_mask<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 16;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm512_set1_ps(float(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    alignas(64) float lanes[16];
+    for (std::size_t i = 0; i < size(); ++i) lanes[i] = gen(i);
+    m_value = _mm512_load_ps(lanes);
+  }
+
+  template <class U, typename std::enable_if<!std::is_same<U, float>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return float(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(__m512 const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator __m512() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  element_aligned_tag) {
+    m_value = _mm512_loadu_ps(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = _mm512_load_ps(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                element_aligned_tag) const {
+    _mm512_storeu_ps(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                vector_aligned_tag) const {
+    _mm512_store_ps(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION float operator[](std::size_t i) const {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(m_value),
+                         _mm512_set1_epi32(std::int32_t(1u << 31)))));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_add_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_sub_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_mul_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(_mm512_div_ps(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_EQ_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_NEQ_UQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_LT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_LE_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_GT_OQ));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(_mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_GE_OQ));
+  }
+
+ private:
+  __m512 m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+condition(simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask,
+          simd<float, simd_abi::avx512_fixed_size<16> > const& a,
+          simd<float, simd_abi::avx512_fixed_size<16> > const& b) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_mask_blend_ps(static_cast<__mmask16>(mask),
+                           static_cast<__m512>(b), static_cast<__m512>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+abs(simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(_mm512_castsi512_ps(
+      _mm512_and_si512(_mm512_castps_si512(static_cast<__m512>(x)),
+                       _mm512_set1_epi32(0x7FFFFFFF))));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+sqrt(simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_sqrt_ps(static_cast<__m512>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+floor(simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(_mm512_roundscale_ps(
+      static_cast<__m512>(x), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+ceil(simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(_mm512_roundscale_ps(
+      static_cast<__m512>(x), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+trunc(simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(_mm512_roundscale_ps(
+      static_cast<__m512>(x), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+copysign(simd<float, simd_abi::avx512_fixed_size<16> > const& a,
+         simd<float, simd_abi::avx512_fixed_size<16> > const& b) {
+  const __m512i sign_mask = _mm512_set1_epi32(std::int32_t(1u << 31));
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_castsi512_ps(_mm512_or_si512(
+          _mm512_andnot_si512(sign_mask,
+                              _mm512_castps_si512(static_cast<__m512>(a))),
+          _mm512_and_si512(sign_mask,
+                           _mm512_castps_si512(static_cast<__m512>(b))))));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+fma(simd<float, simd_abi::avx512_fixed_size<16> > const& a,
+    simd<float, simd_abi::avx512_fixed_size<16> > const& b,
+    simd<float, simd_abi::avx512_fixed_size<16> > const& c) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_fmadd_ps(static_cast<__m512>(a), static_cast<__m512>(b),
+                      static_cast<__m512>(c)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+min(simd<float, simd_abi::avx512_fixed_size<16> > const& a,
+    simd<float, simd_abi::avx512_fixed_size<16> > const& b) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_min_ps(static_cast<__m512>(b), static_cast<__m512>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::avx512_fixed_size<16> >
+max(simd<float, simd_abi::avx512_fixed_size<16> > const& a,
+    simd<float, simd_abi::avx512_fixed_size<16> > const& b) {
+  return simd<float, simd_abi::avx512_fixed_size<16> >(
+      _mm512_max_ps(static_cast<__m512>(b), static_cast<__m512>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION float reduce(
+    simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return _mm512_reduce_add_ps(static_cast<__m512>(x));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION float hmin(
+    simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return _mm512_reduce_min_ps(static_cast<__m512>(x));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION float hmax(
+    simd<float, simd_abi::avx512_fixed_size<16> > const& x) {
+  return _mm512_reduce_max_ps(static_cast<__m512>(x));
+}
+
+namespace Impl {
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_from(
+    simd<float, simd_abi::avx512_fixed_size<16> >& value,
+    simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask,
+    float const* ptr) {
+  value = simd<float, simd_abi::avx512_fixed_size<16> >(_mm512_mask_loadu_ps(
+      static_cast<__m512>(value), static_cast<__mmask16>(mask), ptr));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION void simd_masked_copy_to(
+    simd<float, simd_abi::avx512_fixed_size<16> > const& value,
+    simd_mask<float, simd_abi::avx512_fixed_size<16> > const& mask,
+    float* ptr) {
+  _mm512_mask_storeu_ps(ptr, static_cast<__mmask16>(mask),
+                        static_cast<__m512>(value));
+}
+
+}  // namespace Impl
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* KOKKOS_SIMD_AVX512_HPP */
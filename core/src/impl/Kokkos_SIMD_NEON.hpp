@@ -0,0 +1,667 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SIMD_NEON_HPP
+#define KOKKOS_SIMD_NEON_HPP
+
+// NEON specializations of simd and simd_mask for 2 double and 4 float
+// lanes on AArch64.  Included by Kokkos_SIMD.hpp when the compiler
+// targets NEON.  NEON has no masked loads or stores, so where-expression
+// memory access uses the generic lane-by-lane versions.
+
+#include <arm_neon.h>
+
+namespace Kokkos {
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+// double, 2 lanes
+
+template <>
+class simd_mask<double, simd_abi::neon_fixed_size<2> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using simd_type  = simd<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(vdupq_n_u64(value ? ~std::uint64_t(0) : std::uint64_t(0))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) {
+    const std::uint64_t lanes[2] = {
+        bool(gen(std::size_t(0))) ? ~std::uint64_t(0) : std::uint64_t(0),
+        bool(gen(std::size_t(1))) ? ~std::uint64_t(0) : std::uint64_t(0)};
+    m_value = vld1q_u64(lanes);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(uint64x2_t const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator uint64x2_t() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    std::uint64_t lanes[2];
+    vst1q_u64(lanes, m_value);
+    return lanes[i] != 0;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vandq_u64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vorrq_u64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(veorq_u64(m_value, simd_mask(true).m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vceqq_u64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(veorq_u64(a.m_value, b.m_value));
+  }
+
+ private:
+  uint64x2_t m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<double, simd_abi::neon_fixed_size<2> > const& mask) {
+  return vminvq_u32(vreinterpretq_u32_u64(static_cast<uint64x2_t>(mask))) !=
+         0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<double, simd_abi::neon_fixed_size<2> > const& mask) {
+  return vmaxvq_u32(vreinterpretq_u32_u64(static_cast<uint64x2_t>(mask))) !=
+         0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<double, simd_abi::neon_fixed_size<2> > const& mask) {
+  return !any_of(mask);
+}
+
+template <>
+class simd<double, simd_abi::neon_fixed_size<2> > {
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<double, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdupq_n_f64(double(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, double>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    const double lanes[2] = {double(gen(std::size_t(0))),
+                             double(gen(std::size_t(1)))};
+    m_value = vld1q_f64(lanes);
+  }
+
+  template <class U, typename std::enable_if<!std::is_same<U, double>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return double(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(float64x2_t const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator float64x2_t() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  element_aligned_tag) {
+    m_value = vld1q_f64(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(double const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = vld1q_f64(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                element_aligned_tag) const {
+    vst1q_f64(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(double* ptr,
+                                                vector_aligned_tag) const {
+    vst1q_f64(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION double operator[](std::size_t i) const {
+    double lanes[2];
+    vst1q_f64(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vnegq_f64(m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(vaddq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(vsubq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(vmulq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(vdivq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vceqq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return !(a == b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(vcltq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vcleq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(vcgtq_f64(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vcgeq_f64(a.m_value, b.m_value));
+  }
+
+ private:
+  float64x2_t m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+condition(simd_mask<double, simd_abi::neon_fixed_size<2> > const& mask,
+          simd<double, simd_abi::neon_fixed_size<2> > const& a,
+          simd<double, simd_abi::neon_fixed_size<2> > const& b) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vbslq_f64(static_cast<uint64x2_t>(mask), static_cast<float64x2_t>(a),
+                static_cast<float64x2_t>(b)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+abs(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vabsq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+sqrt(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vsqrtq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+floor(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vrndmq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+ceil(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vrndpq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+round(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vrndaq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+trunc(simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vrndq_f64(static_cast<float64x2_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+copysign(simd<double, simd_abi::neon_fixed_size<2> > const& a,
+         simd<double, simd_abi::neon_fixed_size<2> > const& b) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vbslq_f64(vdupq_n_u64(std::uint64_t(1) << 63),
+                static_cast<float64x2_t>(b), static_cast<float64x2_t>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+fma(simd<double, simd_abi::neon_fixed_size<2> > const& a,
+    simd<double, simd_abi::neon_fixed_size<2> > const& b,
+    simd<double, simd_abi::neon_fixed_size<2> > const& c) {
+  return simd<double, simd_abi::neon_fixed_size<2> >(
+      vfmaq_f64(static_cast<float64x2_t>(c), static_cast<float64x2_t>(a),
+                static_cast<float64x2_t>(b)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+min(simd<double, simd_abi::neon_fixed_size<2> > const& a,
+    simd<double, simd_abi::neon_fixed_size<2> > const& b) {
+  return condition(b < a, b, a);
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<double, simd_abi::neon_fixed_size<2> >
+max(simd<double, simd_abi::neon_fixed_size<2> > const& a,
+    simd<double, simd_abi::neon_fixed_size<2> > const& b) {
+  return condition(a < b, b, a);
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION double reduce(
+    simd<double, simd_abi::neon_fixed_size<2> > const& x) {
+  return vaddvq_f64(static_cast<float64x2_t>(x));
+}
+
+//----------------------------------------------------------------------------
+// float, 4 lanes
+
+template <>
+class simd_mask<float, simd_abi::neon_fixed_size<4> > {
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::neon_fixed_size<4>;
+  using simd_type  = simd<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+
+  simd_mask() = default;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(bool value)
+      : m_value(vdupq_n_u32(value ? ~std::uint32_t(0) : std::uint32_t(0))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, bool>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) {
+    std::uint32_t lanes[4];
+    for (std::size_t i = 0; i < size(); ++i) {
+      lanes[i] = bool(gen(i)) ? ~std::uint32_t(0) : std::uint32_t(0);
+    }
+    m_value = vld1q_u32(lanes);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd_mask(uint32x4_t const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator uint32x4_t() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION bool operator[](std::size_t i) const {
+    std::uint32_t lanes[4];
+    vst1q_u32(lanes, m_value);
+    return lanes[i] != 0;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator&&(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vandq_u32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator||(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vorrq_u32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(vmvnq_u32(m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator==(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(vceqq_u32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd_mask operator!=(
+      simd_mask const& a, simd_mask const& b) {
+    return simd_mask(veorq_u32(a.m_value, b.m_value));
+  }
+
+ private:
+  uint32x4_t m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<float, simd_abi::neon_fixed_size<4> > const& mask) {
+  return vminvq_u32(static_cast<uint32x4_t>(mask)) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<float, simd_abi::neon_fixed_size<4> > const& mask) {
+  return vmaxvq_u32(static_cast<uint32x4_t>(mask)) != 0;
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<float, simd_abi::neon_fixed_size<4> > const& mask) {
+  return !any_of(mask);
+}
+
+template <>
+class simd<float, simd_abi::neon_fixed_size<4> > {
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::neon_fixed_size<4>;
+  using mask_type  = simd_mask<float, abi_type>;
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+
+  simd() = default;
+
+  template <class U, typename std::enable_if<
+                         std::is_convertible<U, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdupq_n_f32(float(value))) {}
+
+  template <class G, typename std::enable_if<
+                         Impl::IsSimdGenerator<G, float>::value, int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    const float lanes[4] = {
+        float(gen(std::size_t(0))), float(gen(std::size_t(1))),
+        float(gen(std::size_t(2))), float(gen(std::size_t(3)))};
+    m_value = vld1q_f32(lanes);
+  }
+
+  template <class U, typename std::enable_if<!std::is_same<U, float>::value,
+                                             int>::type = 0>
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(simd<U, abi_type> const& other)
+      : simd([&](std::size_t i) { return float(other[i]); }) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit simd(float32x4_t const& value)
+      : m_value(value) {}
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION explicit operator float32x4_t() const {
+    return m_value;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  element_aligned_tag) {
+    m_value = vld1q_f32(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_from(float const* ptr,
+                                                  vector_aligned_tag) {
+    m_value = vld1q_f32(ptr);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                element_aligned_tag) const {
+    vst1q_f32(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION void copy_to(float* ptr,
+                                                vector_aligned_tag) const {
+    vst1q_f32(ptr, m_value);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION float operator[](std::size_t i) const {
+    float lanes[4];
+    vst1q_f32(lanes, m_value);
+    return lanes[i];
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vnegq_f32(m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator+(simd const& a,
+                                                         simd const& b) {
+    return simd(vaddq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator-(simd const& a,
+                                                         simd const& b) {
+    return simd(vsubq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator*(simd const& a,
+                                                         simd const& b) {
+    return simd(vmulq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend simd operator/(simd const& a,
+                                                         simd const& b) {
+    return simd(vdivq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator+=(simd const& other) {
+    return *this = *this + other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator-=(simd const& other) {
+    return *this = *this - other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator*=(simd const& other) {
+    return *this = *this * other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION simd& operator/=(simd const& other) {
+    return *this = *this / other;
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator==(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vceqq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator!=(simd const& a,
+                                                               simd const& b) {
+    return !(a == b);
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<(simd const& a,
+                                                              simd const& b) {
+    return mask_type(vcltq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator<=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vcleq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>(simd const& a,
+                                                              simd const& b) {
+    return mask_type(vcgtq_f32(a.m_value, b.m_value));
+  }
+
+  KOKKOS_IMPL_FORCEINLINE_FUNCTION friend mask_type operator>=(simd const& a,
+                                                               simd const& b) {
+    return mask_type(vcgeq_f32(a.m_value, b.m_value));
+  }
+
+ private:
+  float32x4_t m_value;
+};
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+condition(simd_mask<float, simd_abi::neon_fixed_size<4> > const& mask,
+          simd<float, simd_abi::neon_fixed_size<4> > const& a,
+          simd<float, simd_abi::neon_fixed_size<4> > const& b) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vbslq_f32(static_cast<uint32x4_t>(mask), static_cast<float32x4_t>(a),
+                static_cast<float32x4_t>(b)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+abs(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vabsq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+sqrt(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vsqrtq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+floor(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vrndmq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+ceil(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vrndpq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+round(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vrndaq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+trunc(simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vrndq_f32(static_cast<float32x4_t>(x)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+copysign(simd<float, simd_abi::neon_fixed_size<4> > const& a,
+         simd<float, simd_abi::neon_fixed_size<4> > const& b) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vbslq_f32(vdupq_n_u32(std::uint32_t(1) << 31),
+                static_cast<float32x4_t>(b), static_cast<float32x4_t>(a)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+fma(simd<float, simd_abi::neon_fixed_size<4> > const& a,
+    simd<float, simd_abi::neon_fixed_size<4> > const& b,
+    simd<float, simd_abi::neon_fixed_size<4> > const& c) {
+  return simd<float, simd_abi::neon_fixed_size<4> >(
+      vfmaq_f32(static_cast<float32x4_t>(c), static_cast<float32x4_t>(a),
+                static_cast<float32x4_t>(b)));
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+min(simd<float, simd_abi::neon_fixed_size<4> > const& a,
+    simd<float, simd_abi::neon_fixed_size<4> > const& b) {
+  return condition(b < a, b, a);
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION simd<float, simd_abi::neon_fixed_size<4> >
+max(simd<float, simd_abi::neon_fixed_size<4> > const& a,
+    simd<float, simd_abi::neon_fixed_size<4> > const& b) {
+  return condition(a < b, b, a);
+}
+
+KOKKOS_IMPL_FORCEINLINE_FUNCTION float reduce(
+    simd<float, simd_abi::neon_fixed_size<4> > const& x) {
+  return vaddvq_f32(static_cast<float32x4_t>(x));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* KOKKOS_SIMD_NEON_HPP */
@@ -47,6 +47,7 @@
 
 #include <Kokkos_Layout.hpp>
 #include <Kokkos_View.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -163,6 +164,21 @@ struct ViewOffset<
     SHIFT_8T = SHIFT_0 + SHIFT_1 + SHIFT_2 + SHIFT_3 + SHIFT_4 + SHIFT_5 +
                SHIFT_6 + SHIFT_7
   };
+  // log2 of the number of entries in a tile of this rank
+  enum : unsigned {
+    SHIFT_T = VORank == 2
+                  ? unsigned(SHIFT_2T)
+                  : VORank == 3
+                        ? unsigned(SHIFT_3T)
+                        : VORank == 4
+                              ? unsigned(SHIFT_4T)
+                              : VORank == 5
+                                    ? unsigned(SHIFT_5T)
+                                    : VORank == 6
+                                          ? unsigned(SHIFT_6T)
+                                          : VORank == 7 ? unsigned(SHIFT_7T)
+                                                        : unsigned(SHIFT_8T)
+  };
 
   // Is an irregular layout that does not have uniform striding for each index.
   using is_mapping_plugin = std::true_type;
@@ -493,8 +509,8 @@ struct ViewOffset<
   //----------------------------------------
 
   KOKKOS_INLINE_FUNCTION constexpr array_layout layout() const {
-    return array_layout(m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N2, m_dim.N3,
-                        m_dim.N4, m_dim.N5, m_dim.N6, m_dim.N7);
+    return array_layout(m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3, m_dim.N4,
+                        m_dim.N5, m_dim.N6, m_dim.N7);
   }
 
   KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const {
@@ -567,37 +583,51 @@ struct ViewOffset<
     }
   }
 
+  // Storage position, counted in tiles, of the tile with tile coordinates t.
+  KOKKOS_INLINE_FUNCTION constexpr size_type tile_index(
+      const size_type* t) const {
+    const size_type num_tiles[8] = {m_tile_N0, m_tile_N1, m_tile_N2,
+                                    m_tile_N3, m_tile_N4, m_tile_N5,
+                                    m_tile_N6, m_tile_N7};
+    size_type index = 0;
+    for (int k = 0; k < VORank; ++k) {
+      const int r =
+          (outer_pattern == Kokkos::Iterate::Left) ? VORank - 1 - k : k;
+      index = index * num_tiles[r] + t[r];
+    }
+    return index;
+  }
+
   KOKKOS_INLINE_FUNCTION constexpr size_type span() const {
-    // Rank2: ( NumTile0 * ( NumTile1 ) ) * TileSize, etc
-    return (VORank == 2)
-               ? (m_tile_N0 * m_tile_N1) << SHIFT_2T
-               : (VORank == 3)
-                     ? (m_tile_N0 * m_tile_N1 * m_tile_N2) << SHIFT_3T
-                     : (VORank == 4)
-                           ? (m_tile_N0 * m_tile_N1 * m_tile_N2 * m_tile_N3)
-                                 << SHIFT_4T
-                           : (VORank == 5)
-                                 ? (m_tile_N0 * m_tile_N1 * m_tile_N2 *
-                                    m_tile_N3 * m_tile_N4)
-                                       << SHIFT_5T
-                                 : (VORank == 6)
-                                       ? (m_tile_N0 * m_tile_N1 * m_tile_N2 *
-                                          m_tile_N3 * m_tile_N4 * m_tile_N5)
-                                             << SHIFT_6T
-                                       : (VORank == 7)
-                                             ? (m_tile_N0 * m_tile_N1 *
-                                                m_tile_N2 * m_tile_N3 *
-                                                m_tile_N4 * m_tile_N5 *
-                                                m_tile_N6)
-                                                   << SHIFT_7T
-                                             : (m_tile_N0 * m_tile_N1 *
-                                                m_tile_N2 * m_tile_N3 *
-                                                m_tile_N4 * m_tile_N5 *
-                                                m_tile_N6 * m_tile_N7)
-                                                   << SHIFT_8T;
+    // The tile holding the last entry is the last tile in storage order.
+    const size_type dims[8] = {m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3,
+                               m_dim.N4, m_dim.N5, m_dim.N6, m_dim.N7};
+    const unsigned shifts[8] = {SHIFT_0, SHIFT_1, SHIFT_2, SHIFT_3,
+                                SHIFT_4, SHIFT_5, SHIFT_6, SHIFT_7};
+    size_type last_tile[8] = {};
+    for (int r = 0; r < VORank; ++r) {
+      if (dims[r] == 0) return 0;
+      last_tile[r] = (dims[r] - 1) >> shifts[r];
+    }
+    return (tile_index(last_tile) + 1) << SHIFT_T;
   }
 
+  // A subview of whole tiles is contiguous when it keeps every tile of the
+  // source in all but the slowest varying tile dimension.
   KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    const size_type dims[8] = {m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3,
+                               m_dim.N4, m_dim.N5, m_dim.N6, m_dim.N7};
+    const unsigned shifts[8] = {SHIFT_0, SHIFT_1, SHIFT_2, SHIFT_3,
+                                SHIFT_4, SHIFT_5, SHIFT_6, SHIFT_7};
+    const size_type num_tiles[8] = {m_tile_N0, m_tile_N1, m_tile_N2,
+                                    m_tile_N3, m_tile_N4, m_tile_N5,
+                                    m_tile_N6, m_tile_N7};
+    const int slowest =
+        (outer_pattern == Kokkos::Iterate::Left) ? VORank - 1 : 0;
+    for (int r = 0; r < VORank; ++r) {
+      const size_type tiles = dims[r] ? ((dims[r] - 1) >> shifts[r]) + 1 : 0;
+      if (r != slowest && tiles != num_tiles[r]) return false;
+    }
     return true;
   }
 
@@ -657,6 +687,23 @@ struct ViewOffset<
                                : 0),
         m_tile_N7((VORank > 7) ? (arg_layout.dimension[7] + MASK_7) >> SHIFT_7
                                : 0) {}
+
+  // Subview of whole tiles: the source tile counts remain the tile strides.
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, Layout, void>& rhs,
+      const SubviewExtents<DimRHS::rank, dimension_type::rank>& sub)
+      : m_dim(sub.range_extent(0), sub.range_extent(1), sub.range_extent(2),
+              sub.range_extent(3), sub.range_extent(4), sub.range_extent(5),
+              sub.range_extent(6), sub.range_extent(7)),
+        m_tile_N0(rhs.m_tile_N0),
+        m_tile_N1(rhs.m_tile_N1),
+        m_tile_N2(rhs.m_tile_N2),
+        m_tile_N3(rhs.m_tile_N3),
+        m_tile_N4(rhs.m_tile_N4),
+        m_tile_N5(rhs.m_tile_N5),
+        m_tile_N6(rhs.m_tile_N6),
+        m_tile_N7(rhs.m_tile_N7) {}
 };
 
 //----------------------------------------
@@ -1148,6 +1195,100 @@ class ViewMapping<typename std::enable_if<(N0 != 0 && N1 != 0 && N2 != 0 &&
   }
 };
 
+//----------------------------------------
+
+template <class... Args>
+struct is_layout_tiled_subview_args : public std::true_type {};
+
+template <class Arg, class... Args>
+struct is_layout_tiled_subview_args<Arg, Args...>
+    : public std::integral_constant<
+          bool, is_integral_extent_type<typename std::remove_cv<
+                    typename std::remove_reference<Arg>::type>::type>::value &&
+                    is_layout_tiled_subview_args<Args...>::value> {};
+
+// Rank preserving subview of whole tiles.  Every range must begin on a tile
+// boundary and end on a tile boundary or at the source extent; the subview
+// then keeps the source layout and addresses its tiles in place.
+template <class SrcTraits, class... Args>
+class ViewMapping<
+    typename std::enable_if<(
+        std::is_same<typename SrcTraits::specialize, void>::value &&
+        is_array_layout_tiled<typename SrcTraits::array_layout>::value &&
+        is_layout_tiled_subview_args<Args...>::value)>::type,
+    SrcTraits, Args...> {
+ private:
+  static_assert(SrcTraits::rank == sizeof...(Args),
+                "Subview mapping requires one argument for each dimension of "
+                "source View");
+
+  using array_layout = typename SrcTraits::array_layout;
+  using value_type   = typename SrcTraits::value_type;
+
+  using data_type =
+      typename SubViewDataType<value_type,
+                               typename Kokkos::Impl::ParseViewExtents<
+                                   typename SrcTraits::data_type>::type,
+                               Args...>::type;
+
+ public:
+  using traits_type = Kokkos::ViewTraits<data_type, array_layout,
+                                         typename SrcTraits::device_type,
+                                         typename SrcTraits::memory_traits>;
+
+  using type =
+      Kokkos::View<data_type, array_layout, typename SrcTraits::device_type,
+                   typename SrcTraits::memory_traits>;
+
+  template <class MemoryTraits>
+  struct apply {
+    static_assert(Kokkos::Impl::is_memory_traits<MemoryTraits>::value, "");
+
+    using traits_type =
+        Kokkos::ViewTraits<data_type, array_layout,
+                           typename SrcTraits::device_type, MemoryTraits>;
+
+    using type = Kokkos::View<data_type, array_layout,
+                              typename SrcTraits::device_type, MemoryTraits>;
+  };
+
+  template <class DstTraits>
+  KOKKOS_INLINE_FUNCTION static void assign(
+      ViewMapping<DstTraits, void>& dst,
+      ViewMapping<SrcTraits, void> const& src, Args... args) {
+    static_assert(ViewMapping<DstTraits, traits_type, void>::is_assignable,
+                  "Subview destination type must be compatible with subview "
+                  "derived type");
+
+    using dst_offset_type = typename ViewMapping<DstTraits, void>::offset_type;
+
+    const SubviewExtents<SrcTraits::rank, SrcTraits::rank> extents(
+        src.m_impl_offset.m_dim, args...);
+
+    const size_t tile_dims[8] = {array_layout::N0, array_layout::N1,
+                                 array_layout::N2, array_layout::N3,
+                                 array_layout::N4, array_layout::N5,
+                                 array_layout::N6, array_layout::N7};
+    size_t first_tile[8]      = {};
+    for (unsigned r = 0; r < SrcTraits::rank; ++r) {
+      const size_t begin = extents.domain_offset(r);
+      const size_t end   = begin + extents.range_extent(r);
+      if (begin % tile_dims[r] != 0 ||
+          (end % tile_dims[r] != 0 && end != src.m_impl_offset.m_dim.extent(r)))
+        Kokkos::abort(
+            "Kokkos::subview of LayoutTiled requires ranges of whole tiles");
+      first_tile[r] = begin / tile_dims[r];
+    }
+
+    dst.m_impl_offset = dst_offset_type(src.m_impl_offset, extents);
+
+    dst.m_impl_handle = ViewDataHandle<DstTraits>::assign(
+        src.m_impl_handle,
+        src.m_impl_offset.tile_index(first_tile)
+            << src.m_impl_offset.SHIFT_T);
+  }
+};
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 
@@ -1360,6 +1501,49 @@ tile_subview(const Kokkos::View<
       i_tile6, i_tile7);
 }
 
+namespace Experimental {
+
+/** \brief  MDRangePolicy over all entries of a LayoutTiled View whose tiles
+ *          are the View's storage tiles, enumerated in storage order.
+ *
+ *  Each tile of work then touches one contiguous block of memory and
+ *  consecutive tiles, as handed to a thread, are adjacent in memory.
+ */
+template <class ExecSpace, class ViewType>
+inline typename std::enable_if<
+    is_array_layout_tiled<typename ViewType::array_layout>::value,
+    Kokkos::MDRangePolicy<
+        ExecSpace,
+        Kokkos::Rank<ViewType::Rank, ViewType::array_layout::outer_pattern,
+                     ViewType::array_layout::inner_pattern>>>::type
+layout_tiled_policy(const ExecSpace& space, const ViewType& view) {
+  using array_layout = typename ViewType::array_layout;
+
+  const int64_t tile_dims[8] = {array_layout::N0, array_layout::N1,
+                                array_layout::N2, array_layout::N3,
+                                array_layout::N4, array_layout::N5,
+                                array_layout::N6, array_layout::N7};
+  Kokkos::Array<int64_t, ViewType::Rank> lower, upper, tile;
+  for (unsigned r = 0; r < ViewType::Rank; ++r) {
+    lower[r] = 0;
+    upper[r] = view.extent(r);
+    tile[r]  = tile_dims[r];
+  }
+  return Kokkos::MDRangePolicy<
+      ExecSpace,
+      Kokkos::Rank<ViewType::Rank, array_layout::outer_pattern,
+                   array_layout::inner_pattern>>(space, lower, upper, tile);
+}
+
+template <class ViewType>
+inline auto layout_tiled_policy(const ViewType& view)
+    -> decltype(layout_tiled_policy(typename ViewType::execution_space(),
+                                    view)) {
+  return layout_tiled_policy(typename ViewType::execution_space(), view);
+}
+
+}  // namespace Experimental
+
 } /* namespace Kokkos */
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
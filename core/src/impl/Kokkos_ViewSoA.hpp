@@ -0,0 +1,830 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_EXPERIMENTAL_VIEW_SOA_HPP
+#define KOKKOS_EXPERIMENTAL_VIEW_SOA_HPP
+
+#include <cstring>
+#include <Kokkos_Layout.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_CopyViews.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \struct LayoutSoA
+/// \brief Memory layout tag storing a rank-one View of aggregates as a
+///   structure of arrays.
+///
+/// Each element is split into words of min(alignof(T), 8) bytes and
+/// word w of every element is stored in its own stream, so a kernel
+/// that reads one member of every element touches contiguous memory.
+/// With a non-zero VectorLength the streams are interleaved in blocks
+/// of VectorLength elements (AoSoA), which keeps all members of a
+/// block within a few cache lines.
+///
+/// Elements are accessed through a proxy reference: it converts to and
+/// assigns from the value type, and 'view(i)->*&T::member' yields a
+/// reference to a single member.  The value type must be trivially
+/// copyable; elements are zero initialized on allocation.
+template <unsigned VectorLength = 0>
+struct LayoutSoA {
+  static_assert(VectorLength == 0 ||
+                    Kokkos::Impl::is_integral_power_of_two(VectorLength),
+                "LayoutSoA must be given a power-of-two vector length");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutSoA<VectorLength>;
+
+  enum : unsigned { vector_length = VectorLength };
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutSoA(LayoutSoA const&) = default;
+  LayoutSoA(LayoutSoA&&)      = default;
+  LayoutSoA& operator=(LayoutSoA const&) = default;
+  LayoutSoA& operator=(LayoutSoA&&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutSoA(size_t N0 = 0, size_t N1 = 0, size_t N2 = 0,
+                               size_t N3 = 0, size_t N4 = 0, size_t N5 = 0,
+                               size_t N6 = 0, size_t N7 = 0)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+template <class Layout>
+struct is_layout_soa : public std::false_type {};
+
+template <unsigned V>
+struct is_layout_soa<Kokkos::Experimental::LayoutSoA<V>>
+    : public std::true_type {};
+
+/** \brief  Word size and word type used to transpose a value type */
+template <class T, size_t Size = (alignof(T) < 8 ? alignof(T) : 8)>
+struct ViewSoAWord;
+
+template <class T>
+struct ViewSoAWord<T, 1> {
+  using type = uint8_t;
+};
+template <class T>
+struct ViewSoAWord<T, 2> {
+  using type = uint16_t;
+};
+template <class T>
+struct ViewSoAWord<T, 4> {
+  using type = uint32_t;
+};
+template <class T>
+struct ViewSoAWord<T, 8> {
+  using type = uint64_t;
+};
+
+template <class MemberPointer>
+struct ViewSoAMember;
+
+template <class T, class M>
+struct ViewSoAMember<M T::*> {
+  using class_type  = T;
+  using member_type = M;
+};
+
+/** \brief  Byte offset of a data member, offsetof() for a pointer to member.
+ *          Folds to a constant once inlined.
+ */
+template <class T, class M>
+KOKKOS_FORCEINLINE_FUNCTION size_t view_soa_member_offset(M T::*member) {
+  alignas(T) char probe[sizeof(T)];
+  return size_t(
+      reinterpret_cast<const char*>(&(reinterpret_cast<T*>(probe)->*member)) -
+      probe);
+}
+
+/** \brief  Proxy reference to one element of a LayoutSoA View.
+ *
+ *  Word w of the element lives at m_ptr + w * m_stride.
+ */
+template <class ValueType>
+class ViewSoAReference {
+ public:
+  using value_type           = ValueType;
+  using non_const_value_type = typename std::remove_const<ValueType>::type;
+
+ private:
+  using byte_type = typename std::conditional<std::is_const<ValueType>::value,
+                                              const char, char>::type;
+
+  using word_type = typename ViewSoAWord<non_const_value_type>::type;
+
+  enum : size_t { W = sizeof(word_type) };
+  enum : size_t { Words = sizeof(non_const_value_type) / W };
+
+  byte_type* m_ptr;
+  size_t m_stride;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  ViewSoAReference(byte_type* arg_ptr, const size_t arg_stride)
+      : m_ptr(arg_ptr), m_stride(arg_stride) {}
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ViewSoAReference(const ViewSoAReference&) = default;
+
+  /** \brief  Gather the element's words into a value */
+  KOKKOS_FORCEINLINE_FUNCTION
+  operator non_const_value_type() const {
+    non_const_value_type value;
+    char* const dst = reinterpret_cast<char*>(&value);
+    for (size_t w = 0; w < Words; ++w) {
+      memcpy(dst + w * W, m_ptr + w * m_stride, W);
+    }
+    return value;
+  }
+
+  /** \brief  Scatter a value into the element's words */
+  KOKKOS_FORCEINLINE_FUNCTION
+  const ViewSoAReference& operator=(const non_const_value_type& value) const {
+    static_assert(!std::is_const<ValueType>::value,
+                  "Cannot assign through a const LayoutSoA reference");
+    const char* const src = reinterpret_cast<const char*>(&value);
+    for (size_t w = 0; w < Words; ++w) {
+      memcpy(m_ptr + w * m_stride, src + w * W, W);
+    }
+    return *this;
+  }
+
+  /** \brief  Assigning one proxy to another copies the value */
+  KOKKOS_FORCEINLINE_FUNCTION
+  const ViewSoAReference& operator=(const ViewSoAReference& rhs) const {
+    return *this = non_const_value_type(rhs);
+  }
+
+  /** \brief  Reference to a single data member of the element */
+  template <class M>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::conditional<std::is_const<ValueType>::value, const M,
+                                M>::type&
+      operator->*(M non_const_value_type::*member) const {
+    static_assert(!std::is_function<M>::value,
+                  "LayoutSoA member access requires a data member");
+    static_assert(sizeof(M) <= W,
+                  "LayoutSoA member access requires members no wider than "
+                  "the value type alignment");
+    using member_type =
+        typename std::conditional<std::is_const<ValueType>::value, const M,
+                                  M>::type;
+    const size_t offset = view_soa_member_offset(member);
+    return *reinterpret_cast<member_type*>(m_ptr + (offset / W) * m_stride +
+                                           offset % W);
+  }
+};
+
+//----------------------------------------------------------------------------
+
+template <class DataType, unsigned V, class ValueType>
+struct ViewDataAnalysis<DataType, Kokkos::Experimental::LayoutSoA<V>,
+                        ValueType>
+    : public ViewDataAnalysis<DataType, void, ValueType> {
+  using specialize = Kokkos::Experimental::LayoutSoA<V>;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  View mapping for LayoutSoA.
+ *
+ *  SoA     (V == 0): word w of element i at (w * m_stream + i) words.
+ *  AoSoA   (V >  0): word w of element i at
+ *                    ((i / V) * Words * V + w * V + i % V) words.
+ *
+ *  m_stream is the extent of the allocation, so a range subview of an
+ *  SoA View keeps its parent's stream length.
+ */
+template <class Traits, unsigned V>
+class ViewMapping<Traits, Kokkos::Experimental::LayoutSoA<V>> {
+ private:
+  template <class, class...>
+  friend class ViewMapping;
+  template <class, class...>
+  friend class Kokkos::View;
+
+  static_assert(Traits::rank == 1, "LayoutSoA View must be of rank one");
+
+  using value_type           = typename Traits::value_type;
+  using non_const_value_type = typename Traits::non_const_value_type;
+
+  static_assert(std::is_trivially_copyable<non_const_value_type>::value,
+                "LayoutSoA View requires a trivially copyable value type");
+
+  using word_type = typename ViewSoAWord<non_const_value_type>::type;
+  using byte_type = typename std::conditional<std::is_const<value_type>::value,
+                                              const char, char>::type;
+  using dimension = typename Traits::dimension;
+
+  enum : size_t { W = sizeof(word_type) };
+  enum : size_t { Words = sizeof(non_const_value_type) / W };
+
+  using handle_type = value_type*;
+
+  handle_type m_impl_handle;
+  dimension m_dim;
+  size_t m_stream;
+
+  /** \brief  Number of elements allocated for an extent of n */
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t padded_extent(const size_t n) {
+    return V ? ((n + V - 1) / V) * V : n;
+  }
+
+  /** \brief  Word offset of element i's first word */
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_t word_offset(const size_t i) const {
+    return V ? (i / V) * Words * V + i % V : i;
+  }
+
+  /** \brief  Word distance between two consecutive words of an element */
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_t word_stride() const { return V ? V : m_stream; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  byte_type* bytes() const {
+    return reinterpret_cast<byte_type*>(m_impl_handle);
+  }
+
+ public:
+  //----------------------------------------
+  // Domain dimensions
+
+  enum { Rank = Traits::dimension::rank };
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION constexpr size_t extent(const iType& r) const {
+    return m_dim.extent(r);
+  }
+
+  static KOKKOS_INLINE_FUNCTION constexpr size_t static_extent(
+      const unsigned r) noexcept {
+    return dimension::static_extent(r);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr typename Traits::array_layout layout()
+      const {
+    return typename Traits::array_layout(m_dim.N0);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_0() const {
+    return m_dim.N0;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_1() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_2() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_3() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_4() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_5() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_6() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_7() const { return 1; }
+
+  // Elements are not a fixed distance apart in memory.
+  using is_regular = std::false_type;
+
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_0() const { return 1; }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_1() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_2() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_3() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_4() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_5() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_6() const { return span(); }
+  KOKKOS_INLINE_FUNCTION constexpr size_t stride_7() const { return span(); }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    s[0] = 1;
+    s[1] = span();
+  }
+
+  //----------------------------------------
+  // Range span
+
+  /** \brief  Span of the mapped range, in elements.
+   *          A range subview of an SoA View spans the tail of its
+   *          parent's streams.
+   */
+  KOKKOS_INLINE_FUNCTION constexpr size_t span() const {
+    return V || m_stream == m_dim.N0
+               ? padded_extent(m_dim.N0)
+               : ((Words - 1) * m_stream + m_dim.N0 + Words - 1) / Words;
+  }
+
+  /** \brief  Is the mapped range span contiguous */
+  KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    return V || m_stream == m_dim.N0;
+  }
+
+  using reference_type = ViewSoAReference<value_type>;
+  using pointer_type   = handle_type;
+
+  KOKKOS_INLINE_FUNCTION constexpr pointer_type data() const {
+    return m_impl_handle;
+  }
+
+  //----------------------------------------
+  // The View class performs all rank and bounds checking before
+  // calling these element reference methods.
+
+  template <typename I0>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type reference(const I0& i0) const {
+    return reference_type(bytes() + word_offset(i0) * W, word_stride() * W);
+  }
+
+  //----------------------------------------
+
+ private:
+  enum { MemorySpanMask = 8 - 1 /* Force alignment on 8 byte boundary */ };
+
+ public:
+  /** \brief  Span, in bytes, of the referenced memory */
+  KOKKOS_INLINE_FUNCTION constexpr size_t memory_span() const {
+    return (span() * sizeof(value_type) + MemorySpanMask) &
+           ~size_t(MemorySpanMask);
+  }
+
+  //----------------------------------------
+
+  KOKKOS_DEFAULTED_FUNCTION ~ViewMapping() = default;
+  KOKKOS_INLINE_FUNCTION ViewMapping()
+      : m_impl_handle(), m_dim(0, 0, 0, 0, 0, 0, 0, 0), m_stream(0) {}
+
+  KOKKOS_DEFAULTED_FUNCTION ViewMapping(const ViewMapping&) = default;
+  KOKKOS_DEFAULTED_FUNCTION ViewMapping& operator=(const ViewMapping&) =
+      default;
+
+  KOKKOS_DEFAULTED_FUNCTION ViewMapping(ViewMapping&&) = default;
+  KOKKOS_DEFAULTED_FUNCTION ViewMapping& operator=(ViewMapping&&) = default;
+
+  //----------------------------------------
+
+  /**\brief  Span, in bytes, of the required memory */
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t memory_span(
+      typename Traits::array_layout const& arg_layout) {
+    return (padded_extent(arg_layout.dimension[0]) * sizeof(value_type) +
+            MemorySpanMask) &
+           ~size_t(MemorySpanMask);
+  }
+
+  /**\brief  Wrap a span of memory */
+  template <class... P>
+  KOKKOS_INLINE_FUNCTION ViewMapping(
+      Kokkos::Impl::ViewCtorProp<P...> const& arg_prop,
+      typename Traits::array_layout const& arg_layout)
+      : m_impl_handle(
+            ((Kokkos::Impl::ViewCtorProp<void, pointer_type> const&)arg_prop)
+                .value),
+        m_dim(arg_layout.dimension[0], 0, 0, 0, 0, 0, 0, 0),
+        m_stream(m_dim.N0) {}
+
+  /**\brief  Assign data */
+  KOKKOS_INLINE_FUNCTION
+  void assign_data(pointer_type arg_ptr) {
+    m_impl_handle = handle_type(arg_ptr);
+  }
+
+  //----------------------------------------
+  /*  Allocate and zero the mapped array.
+   *  The value type is trivially copyable, so the allocation is
+   *  initialized as an array of words.
+   */
+  template <class... P>
+  Kokkos::Impl::SharedAllocationRecord<>* allocate_shared(
+      Kokkos::Impl::ViewCtorProp<P...> const& arg_prop,
+      typename Traits::array_layout const& arg_layout) {
+    using alloc_prop = Kokkos::Impl::ViewCtorProp<P...>;
+
+    using execution_space = typename alloc_prop::execution_space;
+    using memory_space    = typename Traits::memory_space;
+    using functor_type    = ViewValueFunctor<execution_space, word_type>;
+    using record_type =
+        Kokkos::Impl::SharedAllocationRecord<memory_space, functor_type>;
+
+    m_dim    = dimension(arg_layout.dimension[0], 0, 0, 0, 0, 0, 0, 0);
+    m_stream = m_dim.N0;
+
+    const size_t alloc_size = memory_span(arg_layout);
+    const std::string& alloc_name =
+        static_cast<Kokkos::Impl::ViewCtorProp<void, std::string> const&>(
+            arg_prop)
+            .value;
+    record_type* const record = record_type::allocate(
+        static_cast<Kokkos::Impl::ViewCtorProp<void, memory_space> const&>(
+            arg_prop)
+            .value,
+        alloc_name, alloc_size);
+
+    m_impl_handle = handle_type(reinterpret_cast<pointer_type>(record->data()));
+
+    if (alloc_size && alloc_prop::initialize) {
+      record->m_destroy = functor_type(
+          static_cast<Kokkos::Impl::ViewCtorProp<void, execution_space> const&>(
+              arg_prop)
+              .value,
+          reinterpret_cast<word_type*>(record->data()),
+          padded_extent(m_dim.N0) * Words, alloc_name);
+
+      record->m_destroy.construct_shared_allocation();
+    }
+
+    return record;
+  }
+};
+
+//----------------------------------------------------------------------------
+/** \brief  Assign compatible LayoutSoA mappings */
+
+template <class DstTraits, class SrcTraits, unsigned V>
+class ViewMapping<DstTraits, SrcTraits, Kokkos::Experimental::LayoutSoA<V>> {
+ public:
+  enum {
+    is_assignable_data_type =
+        std::is_same<typename DstTraits::specialize,
+                     typename SrcTraits::specialize>::value &&
+        (std::is_same<typename DstTraits::value_type,
+                      typename SrcTraits::value_type>::value ||
+         std::is_same<typename DstTraits::value_type,
+                      typename SrcTraits::const_value_type>::value)
+  };
+
+  enum {
+    is_assignable =
+        is_assignable_data_type &&
+        std::is_same<typename DstTraits::memory_space,
+                     typename SrcTraits::memory_space>::value &&
+        ViewDimensionAssignable<typename DstTraits::dimension,
+                                typename SrcTraits::dimension>::value
+  };
+
+  using TrackType = Kokkos::Impl::SharedAllocationTracker;
+  using DstType = ViewMapping<DstTraits, Kokkos::Experimental::LayoutSoA<V>>;
+  using SrcType = ViewMapping<SrcTraits, Kokkos::Experimental::LayoutSoA<V>>;
+
+  KOKKOS_INLINE_FUNCTION
+  static void assign(DstType& dst, const SrcType& src,
+                     const TrackType& /*src_track*/) {
+    static_assert(is_assignable, "Incompatible LayoutSoA View assignment");
+
+    dst.m_impl_handle = src.m_impl_handle;
+    dst.m_dim =
+        typename DstType::dimension(src.m_dim.N0, 0, 0, 0, 0, 0, 0, 0);
+    dst.m_stream = src.m_stream;
+  }
+};
+
+//----------------------------------------------------------------------------
+/** \brief  Range subview of a LayoutSoA View.
+ *
+ *  An SoA subview keeps its parent's streams.  An AoSoA subview must
+ *  begin on a block boundary and end on one or at the parent's extent.
+ */
+template <class SrcTraits, class Arg>
+class ViewMapping<
+    typename std::enable_if<(
+        is_layout_soa<typename SrcTraits::specialize>::value &&
+        is_integral_extent_type<typename std::remove_cv<
+            typename std::remove_reference<Arg>::type>::type>::value)>::type,
+    SrcTraits, Arg> {
+ private:
+  using layout_type = typename SrcTraits::specialize;
+
+  static constexpr unsigned V = layout_type::vector_length;
+
+ public:
+  using traits_type =
+      Kokkos::ViewTraits<typename SrcTraits::value_type*, layout_type,
+                         typename SrcTraits::device_type,
+                         typename SrcTraits::memory_traits>;
+
+  using type = Kokkos::View<typename SrcTraits::value_type*, layout_type,
+                            typename SrcTraits::device_type,
+                            typename SrcTraits::memory_traits>;
+
+  KOKKOS_INLINE_FUNCTION
+  static void assign(ViewMapping<traits_type, layout_type>& dst,
+                     ViewMapping<SrcTraits, layout_type> const& src, Arg arg) {
+    using DstType = ViewMapping<traits_type, layout_type>;
+
+    const SubviewExtents<1, 1> extents(src.m_dim, arg);
+
+    const size_t begin = extents.domain_offset(0);
+    const size_t end   = begin + extents.range_extent(0);
+
+    if (V && (begin % V != 0 || (end % V != 0 && end != src.m_dim.N0))) {
+      Kokkos::abort(
+          "Kokkos::subview of an AoSoA View must begin on a block boundary "
+          "and end on a block boundary or at the extent");
+    }
+
+    dst.m_impl_handle = reinterpret_cast<typename DstType::handle_type>(
+        src.bytes() + src.word_offset(begin) * DstType::W);
+    dst.m_dim =
+        typename DstType::dimension(end - begin, 0, 0, 0, 0, 0, 0, 0);
+    dst.m_stream = V ? end - begin : src.m_stream;
+  }
+};
+
+//----------------------------------------------------------------------------
+/** \brief  Subview of a single data member of a LayoutSoA View.
+ *
+ *  'subview(view, &T::member)' returns an ordinary View of the member's
+ *  stream: a View<M*> when the member fills a whole word of an SoA View,
+ *  a strided View<M*> when it shares a word with other members, and a
+ *  strided View<M**> indexed by (block, lane) for an AoSoA View.
+ *  The member View shares the parent's allocation tracking.
+ */
+template <class SrcTraits, class Arg>
+class ViewMapping<
+    typename std::enable_if<(
+        is_layout_soa<typename SrcTraits::specialize>::value &&
+        std::is_member_object_pointer<Arg>::value)>::type,
+    SrcTraits, Arg> {
+ private:
+  using layout_type = typename SrcTraits::specialize;
+  using src_type    = ViewMapping<SrcTraits, layout_type>;
+
+  static_assert(std::is_same<typename ViewSoAMember<Arg>::class_type,
+                             typename SrcTraits::non_const_value_type>::value,
+                "LayoutSoA member subview requires a member of the value type");
+
+  using member_type = typename std::conditional<
+      std::is_const<typename SrcTraits::value_type>::value,
+      const typename ViewSoAMember<Arg>::member_type,
+      typename ViewSoAMember<Arg>::member_type>::type;
+
+  static constexpr unsigned V = layout_type::vector_length;
+  static constexpr size_t W = src_type::W;
+  static constexpr size_t Words = src_type::Words;
+  static constexpr size_t M = sizeof(member_type);
+
+  static_assert(W % M == 0,
+                "LayoutSoA member subview requires members that evenly divide "
+                "the value type alignment");
+
+  using data_type = typename std::conditional<V == 0, member_type*,
+                                              member_type**>::type;
+
+  using array_layout =
+      typename std::conditional<V == 0 && W == M, Kokkos::LayoutLeft,
+                                Kokkos::LayoutStride>::type;
+
+  KOKKOS_INLINE_FUNCTION
+  static array_layout member_layout(const src_type& src, Kokkos::LayoutLeft*) {
+    return Kokkos::LayoutLeft(src.m_dim.N0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static array_layout member_layout(const src_type& src,
+                                    Kokkos::LayoutStride*) {
+    return V == 0 ? Kokkos::LayoutStride(src.m_dim.N0, W / M)
+                  : Kokkos::LayoutStride(
+                        src_type::padded_extent(src.m_dim.N0) / (V ? V : 1),
+                        Words * V * (W / M), V, W / M);
+  }
+
+ public:
+  using traits_type =
+      Kokkos::ViewTraits<data_type, array_layout,
+                         typename SrcTraits::device_type,
+                         typename SrcTraits::memory_traits>;
+
+  using type = Kokkos::View<data_type, array_layout,
+                            typename SrcTraits::device_type,
+                            typename SrcTraits::memory_traits>;
+
+  KOKKOS_INLINE_FUNCTION
+  static void assign(ViewMapping<traits_type, void>& dst, const src_type& src,
+                     Arg member) {
+    using DstType = ViewMapping<traits_type, void>;
+
+    using dst_offset_type = typename DstType::offset_type;
+    using dst_handle_type = typename DstType::handle_type;
+
+    const size_t offset = view_soa_member_offset(member);
+
+    dst.m_impl_offset = dst_offset_type(
+        std::integral_constant<unsigned, 0>(),
+        member_layout(src, static_cast<array_layout*>(nullptr)));
+    dst.m_impl_handle = dst_handle_type(reinterpret_cast<member_type*>(
+        src.bytes() + (offset / W) * src.word_stride() * W + offset % W));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+template <class DstType>
+struct ViewSoAFill {
+  using value_type = typename DstType::non_const_value_type;
+
+  DstType dst;
+  value_type value;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const { dst(i) = value; }
+};
+
+template <class DstType, class SrcType>
+struct ViewSoACopy {
+  DstType dst;
+  SrcType src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const { dst(i) = src(i); }
+};
+
+}  // namespace Impl
+
+/** \brief  Deep copy a value from Host memory into a LayoutSoA view.  */
+template <class DT, class... DP>
+inline void deep_copy(
+    const View<DT, DP...>& dst,
+    typename ViewTraits<DT, DP...>::const_value_type& value,
+    typename std::enable_if<Kokkos::Impl::is_layout_soa<
+        typename ViewTraits<DT, DP...>::specialize>::value>::type* = nullptr) {
+  using dst_type        = View<DT, DP...>;
+  using exec_space_type = typename dst_type::execution_space;
+
+  static_assert(std::is_same<typename dst_type::non_const_value_type,
+                             typename dst_type::value_type>::value,
+                "deep_copy requires non-const type");
+
+  Kokkos::fence();
+  if (dst.data() != nullptr) {
+    Kokkos::parallel_for(
+        "Kokkos::ViewSoAFill",
+        Kokkos::RangePolicy<exec_space_type>(0, dst.extent(0)),
+        Kokkos::Impl::ViewSoAFill<dst_type>{dst, value});
+  }
+  Kokkos::fence();
+}
+
+/** \brief  A deep copy between views where at least one side is a LayoutSoA
+ *          view.  Matching contiguous layouts are copied bytewise, anything
+ *          else is transposed element by element in a space that can access
+ *          both views.
+ */
+template <class DT, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const View<DT, DP...>& dst, const View<ST, SP...>& src,
+    typename std::enable_if<(
+        Kokkos::Impl::is_layout_soa<
+            typename ViewTraits<DT, DP...>::specialize>::value ||
+        Kokkos::Impl::is_layout_soa<
+            typename ViewTraits<ST, SP...>::specialize>::value)>::type* =
+        nullptr) {
+  using dst_type            = View<DT, DP...>;
+  using src_type            = View<ST, SP...>;
+  using dst_execution_space = typename dst_type::execution_space;
+  using src_execution_space = typename src_type::execution_space;
+  using dst_memory_space    = typename dst_type::memory_space;
+  using src_memory_space    = typename src_type::memory_space;
+
+  static_assert(std::is_same<typename dst_type::value_type,
+                             typename dst_type::non_const_value_type>::value,
+                "deep_copy requires non-const destination type");
+
+  static_assert(std::is_same<typename dst_type::non_const_value_type,
+                             typename src_type::non_const_value_type>::value,
+                "deep_copy requires matching value types");
+
+  static_assert(unsigned(dst_type::rank) == 1 && unsigned(src_type::rank) == 1,
+                "deep_copy of a LayoutSoA View requires rank one views");
+
+  enum {
+    DstExecCanAccessSrc =
+        Kokkos::Impl::SpaceAccessibility<dst_execution_space,
+                                         src_memory_space>::accessible
+  };
+
+  enum {
+    SrcExecCanAccessDst =
+        Kokkos::Impl::SpaceAccessibility<src_execution_space,
+                                         dst_memory_space>::accessible
+  };
+
+  if (dst.extent(0) != src.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Deep copy of LayoutSoA views with different extents");
+  }
+
+  Kokkos::fence();
+  if (dst.extent(0) == 0 ||
+      (std::is_same<typename dst_type::array_layout,
+                    typename src_type::array_layout>::value &&
+       static_cast<const void*>(dst.data()) ==
+           static_cast<const void*>(src.data()))) {
+    // Nothing to copy
+  } else if (std::is_same<typename dst_type::array_layout,
+                          typename src_type::array_layout>::value &&
+             dst.span_is_contiguous() && src.span_is_contiguous()) {
+    Kokkos::Impl::DeepCopy<dst_memory_space, src_memory_space>(
+        dst.data(), src.data(), dst.impl_map().memory_span());
+  } else if (DstExecCanAccessSrc) {
+    Kokkos::parallel_for(
+        "Kokkos::ViewSoACopy",
+        Kokkos::RangePolicy<dst_execution_space>(0, dst.extent(0)),
+        Kokkos::Impl::ViewSoACopy<dst_type, src_type>{dst, src});
+  } else if (SrcExecCanAccessDst) {
+    Kokkos::parallel_for(
+        "Kokkos::ViewSoACopy",
+        Kokkos::RangePolicy<src_execution_space>(0, dst.extent(0)),
+        Kokkos::Impl::ViewSoACopy<dst_type, src_type>{dst, src});
+  } else {
+    Kokkos::Impl::throw_runtime_exception(
+        "Deep copy of LayoutSoA views between inaccessible spaces requires "
+        "matching contiguous layouts");
+  }
+  Kokkos::fence();
+}
+
+template <class T, class... P>
+inline typename Kokkos::View<T, P...>::HostMirror create_mirror(
+    const Kokkos::View<T, P...>& src,
+    typename std::enable_if<Kokkos::Impl::is_layout_soa<
+        typename ViewTraits<T, P...>::specialize>::value>::type* = nullptr) {
+  using dst_type = typename Kokkos::View<T, P...>::HostMirror;
+  return dst_type(std::string(src.label()).append("_mirror"), src.layout());
+}
+
+template <class Space, class T, class... P>
+typename Impl::MirrorType<Space, T, P...>::view_type create_mirror(
+    const Space&, const Kokkos::View<T, P...>& src,
+    typename std::enable_if<Kokkos::Impl::is_layout_soa<
+        typename ViewTraits<T, P...>::specialize>::value>::type* = nullptr) {
+  return typename Impl::MirrorType<Space, T, P...>::view_type(src.label(),
+                                                              src.layout());
+}
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_EXPERIMENTAL_VIEW_SOA_HPP */
@@ -1401,6 +1401,55 @@ bool AtomicViewsTestNonIntegralType(const int length, int test) {
   return 0;
 }
 
+// Histogram through a View with relaxed atomic accesses: the counts must be
+// exact even though the updates are not ordered with each other.
+template <class DeviceType>
+struct RelaxedHistogramFunctor {
+  using relaxed_view_type =
+      Kokkos::View<int64_t*, DeviceType,
+                   Kokkos::MemoryTraits<Kokkos::AtomicRelaxed> >;
+  relaxed_view_type bins;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    bins(i % 7)++;
+    bins(7) += i;
+    bins(8) -= 1;
+  }
+};
+
+template <class DeviceType>
+bool AtomicRelaxedViewTest(const int64_t input_length) {
+  using functor_type      = RelaxedHistogramFunctor<DeviceType>;
+  using relaxed_view_type = typename functor_type::relaxed_view_type;
+  static_assert(relaxed_view_type::memory_traits::is_atomic,
+                "AtomicRelaxed implies atomic access");
+  static_assert(relaxed_view_type::memory_traits::is_atomic_relaxed,
+                "AtomicRelaxed memory trait");
+  static_assert(!Kokkos::View<int64_t*, DeviceType,
+                              Kokkos::MemoryTraits<Kokkos::Atomic> >::
+                    memory_traits::is_atomic_relaxed,
+                "Atomic views are sequentially consistent");
+
+  Kokkos::View<int64_t*, DeviceType> result("result", 9);
+  functor_type f;
+  f.bins = result;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType>(0, input_length), f);
+  Kokkos::fence();
+
+  auto h_result =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+  int64_t total = 0;
+  for (int k = 0; k < 7; ++k) {
+    const int64_t expected = input_length / 7 + (k < input_length % 7 ? 1 : 0);
+    if (h_result(k) != expected) return false;
+    total += h_result(k);
+  }
+  return total == input_length &&
+         h_result(7) == input_length * (input_length - 1) / 2 &&
+         h_result(8) == -input_length;
+}
+
 }  // namespace TestAtomicViews
 
 namespace Test {
@@ -1455,6 +1504,10 @@ TEST(TEST_CATEGORY, atomic_views_nonintegral) {
   }
 }
 
+TEST(TEST_CATEGORY, atomic_views_relaxed) {
+  ASSERT_TRUE(TestAtomicViews::AtomicRelaxedViewTest<TEST_EXECSPACE>(100000));
+}
+
 TEST(TEST_CATEGORY, atomic_view_api) {
   TestAtomicViews::TestAtomicViewAPI<int, TEST_EXECSPACE>();
 }
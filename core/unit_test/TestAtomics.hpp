@@ -488,10 +488,280 @@ bool Loop(int loop, int test) {
   return passed;
 }
 
+// Wide types go through the host lock table: every update takes a lock and
+// every load is validated against the lock's sequence number.
+template <class DeviceType>
+struct WideLoadStoreFunctor {
+  using type = SuperScalar<4>;
+  Kokkos::View<type, DeviceType> data;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int, int& errors) const {
+    type value = Kokkos::Impl::atomic_load(data.data());
+    // All four members are updated together, so a torn read would show up
+    // as members that disagree.
+    for (int k = 1; k < 4; ++k) {
+      if (value.val[k] != value.val[0]) ++errors;
+    }
+    type inc;
+    for (int k = 0; k < 4; ++k) inc.val[k] = 1;
+    Kokkos::atomic_add(data.data(), inc);
+  }
+};
+
+template <class DeviceType>
+void test_host_atomic_lock_statistics(int loop) {
+  Kokkos::Tools::Experimental::reset_host_atomic_lock_statistics();
+
+  WideLoadStoreFunctor<DeviceType> f;
+  f.data = Kokkos::View<SuperScalar<4>, DeviceType>("data");
+  int errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType>(0, loop), f, errors);
+  ASSERT_EQ(errors, 0);
+
+  auto h_data =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.data);
+  for (int k = 0; k < 4; ++k) ASSERT_EQ(h_data().val[k], double(loop));
+
+  const auto statistics =
+      Kokkos::Tools::Experimental::get_host_atomic_lock_statistics();
+  ASSERT_GE(statistics.acquisitions, uint64_t(loop));
+  ASSERT_GE(statistics.contended, statistics.max_lock_contended);
+  ASSERT_GT(statistics.locks, 0u);
+}
+
+// 16 byte types use a native double-width compare-and-swap loop on hosts
+// that provide one and the lock table otherwise; the results must agree.
+template <class DeviceType>
+struct Wide16FetchOperFunctor {
+  using pair_type = Kokkos::pair<int64_t, int64_t>;
+  Kokkos::View<pair_type[2], DeviceType> pairs;
+  Kokkos::View<Kokkos::complex<double>, DeviceType> sum;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    const pair_type value(i % 7, i);
+    Kokkos::atomic_fetch_min(&pairs(0), value);
+    Kokkos::atomic_fetch_max(&pairs(1), value);
+    Kokkos::atomic_add(&sum(), Kokkos::complex<double>(1.0, i));
+  }
+};
+
+template <class DeviceType>
+void test_atomic_fetch_oper_16_byte(int loop) {
+  using functor_type = Wide16FetchOperFunctor<DeviceType>;
+  functor_type f;
+  f.pairs = decltype(f.pairs)("pairs");
+  f.sum   = decltype(f.sum)("sum");
+  Kokkos::deep_copy(Kokkos::subview(f.pairs, 0),
+                    typename functor_type::pair_type(7, 0));
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType>(0, loop), f);
+
+  auto h_pairs =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.pairs);
+  auto h_sum = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.sum);
+  ASSERT_EQ(h_pairs(0).first, 0);
+  ASSERT_EQ(h_pairs(0).second, 0);
+  ASSERT_EQ(h_pairs(1).first, 6);
+  ASSERT_EQ(h_pairs(1).second, loop - 1 - (loop - 1 - 6) % 7);
+  ASSERT_EQ(h_sum().real(), double(loop));
+  ASSERT_EQ(h_sum().imag(), 0.5 * loop * (loop - 1));
+}
+
+// atomic_load and atomic_store pick an implementation by type: compiler
+// builtins for words, the 16 byte compare-and-swap or the host lock table
+// for wider types.  Every stored value has members that agree with each
+// other, so a torn load shows up as an inconsistent value.
+template <class T>
+struct LoadStoreValue;
+
+template <>
+struct LoadStoreValue<float> {
+  KOKKOS_INLINE_FUNCTION static float make(int i) { return float(i); }
+  KOKKOS_INLINE_FUNCTION static bool consistent(float v, int n) {
+    return v >= 0.0f && v < float(n) && v == float(int(v));
+  }
+};
+
+template <>
+struct LoadStoreValue<double> {
+  KOKKOS_INLINE_FUNCTION static double make(int i) { return double(i); }
+  KOKKOS_INLINE_FUNCTION static bool consistent(double v, int n) {
+    return v >= 0.0 && v < double(n) && v == double(int(v));
+  }
+};
+
+template <>
+struct LoadStoreValue<Kokkos::complex<double>> {
+  KOKKOS_INLINE_FUNCTION static Kokkos::complex<double> make(int i) {
+    return Kokkos::complex<double>(i, -i);
+  }
+  KOKKOS_INLINE_FUNCTION static bool consistent(Kokkos::complex<double> v,
+                                                int n) {
+    return LoadStoreValue<double>::consistent(v.real(), n) &&
+           v.imag() == -v.real();
+  }
+};
+
+template <>
+struct LoadStoreValue<SuperScalar<4>> {
+  KOKKOS_INLINE_FUNCTION static SuperScalar<4> make(int i) {
+    SuperScalar<4> v;
+    for (int k = 0; k < 4; ++k) v.val[k] = i;
+    return v;
+  }
+  KOKKOS_INLINE_FUNCTION static bool consistent(SuperScalar<4> v, int n) {
+    for (int k = 1; k < 4; ++k) {
+      if (v.val[k] != v.val[0]) return false;
+    }
+    return LoadStoreValue<double>::consistent(v.val[0], n);
+  }
+};
+
+template <class T, class DeviceType>
+struct LoadStoreFunctor {
+  Kokkos::View<T, DeviceType> data;
+  int loop;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, int& errors) const {
+    using value = LoadStoreValue<T>;
+    Kokkos::Impl::atomic_store(data.data(), value::make(i),
+                               Kokkos::Impl::memory_order_release);
+    if (!value::consistent(Kokkos::Impl::atomic_load(
+                               data.data(), Kokkos::Impl::memory_order_acquire),
+                           loop))
+      ++errors;
+    if (!value::consistent(Kokkos::Impl::atomic_load(data.data()), loop))
+      ++errors;
+  }
+};
+
+template <class T, class DeviceType>
+void test_atomic_load_store(int loop) {
+  LoadStoreFunctor<T, DeviceType> f;
+  f.data = Kokkos::View<T, DeviceType>("data");
+  f.loop = loop;
+  Kokkos::deep_copy(f.data, LoadStoreValue<T>::make(0));
+  int errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType>(0, loop), f, errors);
+  ASSERT_EQ(errors, 0);
+
+  auto h_data =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.data);
+  ASSERT_TRUE(LoadStoreValue<T>::consistent(h_data(), loop));
+}
+
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+// A 16 byte atomic_load must not write to the loaded line, so it works on
+// read-only memory; constant data lives in a read-only segment.
+struct alignas(16) ReadOnly16 {
+  int64_t first;
+  int64_t second;
+};
+
+static const ReadOnly16 read_only_16 = {3, -3};
+
+inline void test_atomic_load_read_only() {
+  if (!Kokkos::Impl::load128_is_atomic()) return;
+  const ReadOnly16 value = Kokkos::Impl::atomic_load(&read_only_16);
+  ASSERT_EQ(value.first, 3);
+  ASSERT_EQ(value.second, -3);
+}
+#endif
+
+// Relaxed read-modify-write operations still have to be atomic; only the
+// ordering with respect to other memory locations is weakened.
+template <class DeviceType>
+struct ExplicitOrderFunctor {
+  Kokkos::View<int64_t[5], DeviceType> ints;
+  Kokkos::View<double[2], DeviceType> reals;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    using Kokkos::memory_order_relaxed;
+    Kokkos::atomic_fetch_add(&ints(0), int64_t(i), memory_order_relaxed);
+    Kokkos::atomic_fetch_sub(&ints(1), int64_t(1),
+                             Kokkos::memory_order_acq_rel);
+    Kokkos::atomic_fetch_max(&ints(2), int64_t(i), memory_order_relaxed);
+    Kokkos::atomic_fetch_or(&ints(3), int64_t(1) << (i % 64),
+                            Kokkos::memory_order_release);
+    Kokkos::atomic_increment(&ints(4), memory_order_relaxed);
+    Kokkos::atomic_add(&reals(0), 0.5, memory_order_relaxed);
+    // Compare-and-swap loop with relaxed retries.
+    double old = Kokkos::atomic_load(&reals(1), memory_order_relaxed);
+    double assumed;
+    do {
+      assumed = old;
+      old     = Kokkos::atomic_compare_exchange(
+          &reals(1), assumed, assumed + 1, Kokkos::memory_order_acquire);
+    } while (old != assumed);
+  }
+};
+
+template <class DeviceType>
+void test_atomic_explicit_order(int loop) {
+  ExplicitOrderFunctor<DeviceType> f;
+  f.ints  = decltype(f.ints)("ints");
+  f.reals = decltype(f.reals)("reals");
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType>(0, loop), f);
+  Kokkos::fence();
+
+  auto h_ints =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.ints);
+  auto h_reals =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), f.reals);
+  ASSERT_EQ(h_ints(0), int64_t(loop) * (loop - 1) / 2);
+  ASSERT_EQ(h_ints(1), -int64_t(loop));
+  ASSERT_EQ(h_ints(2), int64_t(loop - 1));
+  ASSERT_EQ(h_ints(3), loop >= 64 ? int64_t(-1) : (int64_t(1) << loop) - 1);
+  ASSERT_EQ(h_ints(4), int64_t(loop));
+  ASSERT_EQ(h_reals(0), 0.5 * loop);
+  ASSERT_EQ(h_reals(1), double(loop));
+
+  // Sequentially consistent requests forward to the existing atomics.
+  int value = 3;
+  ASSERT_EQ(Kokkos::atomic_exchange(&value, 4, Kokkos::memory_order_seq_cst),
+            3);
+  Kokkos::atomic_store(&value, 5, Kokkos::memory_order_release);
+  ASSERT_EQ(Kokkos::atomic_load(&value, Kokkos::memory_order_acquire), 5);
+}
+
 }  // namespace TestAtomic
 
 namespace Test {
 
+#ifndef KOKKOS_ENABLE_HIP  // FIXME_HIP atomics for >64bit types
+TEST(TEST_CATEGORY, atomics_16_byte_fetch_oper) {
+  TestAtomic::test_atomic_fetch_oper_16_byte<TEST_EXECSPACE>(1000);
+}
+#endif
+
+#ifndef KOKKOS_ENABLE_HIP  // FIXME_HIP atomics for >64bit types
+TEST(TEST_CATEGORY, atomics_load_store) {
+  TestAtomic::test_atomic_load_store<float, TEST_EXECSPACE>(1000);
+  TestAtomic::test_atomic_load_store<double, TEST_EXECSPACE>(1000);
+  TestAtomic::test_atomic_load_store<Kokkos::complex<double>, TEST_EXECSPACE>(
+      1000);
+  TestAtomic::test_atomic_load_store<TestAtomic::SuperScalar<4>,
+                                     TEST_EXECSPACE>(1000);
+#if defined(KOKKOS_IMPL_ENABLE_CAS128)
+  TestAtomic::test_atomic_load_read_only();
+#endif
+}
+#endif
+
+TEST(TEST_CATEGORY, atomics_explicit_memory_order) {
+  TestAtomic::test_atomic_explicit_order<TEST_EXECSPACE>(1000);
+}
+
+TEST(TEST_CATEGORY, atomics_host_lock_statistics) {
+  if (!Kokkos::Impl::MemorySpaceAccess<
+          Kokkos::HostSpace, TEST_EXECSPACE::memory_space>::accessible)
+    return;
+  TestAtomic::test_host_atomic_lock_statistics<TEST_EXECSPACE>(1000);
+}
+
 TEST(TEST_CATEGORY, atomics) {
   const int loop_count = 1e4;
 
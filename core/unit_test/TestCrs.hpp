@@ -42,6 +42,7 @@
 //@HEADER
 */
 
+#include <algorithm>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -199,6 +200,61 @@ void test_constructor(std::int32_t nrows) {
   }
 }
 
+// Every row links to a few neighbours and to the hub column 0, so the
+// transposed graph has one very long row.
+template <class ExecSpace>
+struct HubGraphFunctor {
+  std::int32_t nrows;
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t operator()(std::int32_t row, std::int32_t *fill) const {
+    auto n = (row % 4) + 1;
+    if (fill) {
+      fill[0] = 0;
+      for (std::int32_t j = 1; j < n; ++j) {
+        fill[j] = (row * 7 + j * j) % nrows;
+      }
+    }
+    return n;
+  }
+};
+
+template <class ExecSpace>
+void test_transpose(std::int32_t nrows) {
+  using crs_type = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  crs_type graph;
+  Kokkos::count_and_fill_crs(graph, nrows, HubGraphFunctor<ExecSpace>{nrows});
+
+  crs_type atomic_transpose, bucketed_transpose;
+  Kokkos::transpose_crs(atomic_transpose, graph);
+  Kokkos::transpose_crs_bucketed(bucketed_transpose, graph);
+
+  auto row_map = Kokkos::create_mirror_view(atomic_transpose.row_map);
+  Kokkos::deep_copy(row_map, atomic_transpose.row_map);
+  auto entries = Kokkos::create_mirror_view(atomic_transpose.entries);
+  Kokkos::deep_copy(entries, atomic_transpose.entries);
+  auto bucketed_row_map =
+      Kokkos::create_mirror_view(bucketed_transpose.row_map);
+  Kokkos::deep_copy(bucketed_row_map, bucketed_transpose.row_map);
+  auto bucketed_entries =
+      Kokkos::create_mirror_view(bucketed_transpose.entries);
+  Kokkos::deep_copy(bucketed_entries, bucketed_transpose.entries);
+
+  ASSERT_EQ(bucketed_transpose.numRows(), nrows);
+  ASSERT_EQ(bucketed_entries.extent(0), entries.extent(0));
+  for (std::int32_t row = 0; row <= nrows; ++row) {
+    ASSERT_EQ(bucketed_row_map(row), row_map(row));
+  }
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    // Entries of the bucketed transpose come out sorted.
+    std::vector<std::int32_t> expected(entries.data() + row_map(row),
+                                       entries.data() + row_map(row + 1));
+    std::sort(expected.begin(), expected.end());
+    for (std::int32_t j = row_map(row); j < row_map(row + 1); ++j) {
+      ASSERT_EQ(bucketed_entries(j), expected[j - row_map(row)]);
+    }
+  }
+}
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, crs_count_fill) {
@@ -223,4 +279,12 @@ TEST(TEST_CATEGORY, crs_copy_constructor) {
   test_constructor<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, crs_transpose) {
+  test_transpose<TEST_EXECSPACE>(0);
+  test_transpose<TEST_EXECSPACE>(1);
+  test_transpose<TEST_EXECSPACE>(13);
+  test_transpose<TEST_EXECSPACE>(1000);
+  test_transpose<TEST_EXECSPACE>(10000);
+}
+
 }  // namespace Test
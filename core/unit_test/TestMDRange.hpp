@@ -43,6 +43,7 @@
 */
 
 #include <cstdio>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -3685,6 +3686,87 @@ struct TestMDRange_ReduceScalar {
   }
 };
 
+template <typename ExecSpace>
+struct TestMDRange_TileOrder {
+  using value_type = int;
+  using ViewType   = typename Kokkos::View<int ***, ExecSpace>;
+
+  ViewType input_view;
+
+  TestMDRange_TileOrder(const int N0, const int N1, const int N2)
+      : input_view("input_view", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    input_view(i, j, k) += 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k, int &lsum) const {
+    lsum += input_view(i, j, k);
+  }
+
+  static void test_morton_coordinates() {
+    using point_type = Kokkos::Array<int64_t, 2>;
+
+    // Power-of-two grid: tile index bits interleave, dimension 1 lowest
+    const point_type square{{4, 4}};
+    point_type coord;
+    Kokkos::Impl::morton_tile_coordinates<2, 1>(6, square, coord);
+    ASSERT_EQ(coord[0], 1);
+    ASSERT_EQ(coord[1], 2);
+    Kokkos::Impl::morton_tile_coordinates<2, 0>(6, square, coord);
+    ASSERT_EQ(coord[0], 2);
+    ASSERT_EQ(coord[1], 1);
+
+    // Other grids: every tile is visited once and the first tiles form a
+    // compact block
+    const point_type grid{{5, 3}};
+    std::vector<int> visits(grid[0] * grid[1], 0);
+    for (int64_t t = 0; t < grid[0] * grid[1]; ++t) {
+      Kokkos::Impl::morton_tile_coordinates<2, 1>(t, grid, coord);
+      ASSERT_LT(coord[0], grid[0]);
+      ASSERT_LT(coord[1], grid[1]);
+      if (t < 4) {
+        ASSERT_LT(coord[0], 2);
+        ASSERT_LT(coord[1], 2);
+      }
+      ++visits[coord[0] * grid[1] + coord[1]];
+    }
+    for (int v : visits) ASSERT_EQ(v, 1);
+  }
+
+  template <Kokkos::Iterate Outer, Kokkos::Iterate Inner>
+  static void test_tile_order(const int N0, const int N1, const int N2) {
+    using range_type =
+        typename Kokkos::MDRangePolicy<ExecSpace,
+                                       Kokkos::Rank<3, Outer, Inner>,
+                                       Kokkos::IndexType<int>>;
+    using tile_type  = typename range_type::tile_type;
+    using point_type = typename range_type::point_type;
+
+    range_type range(point_type{{1, 0, 2}}, point_type{{N0, N1, N2}},
+                     tile_type{{3, 4, 5}});
+    range.set_tile_order(Kokkos::TileOrder::Morton);
+
+    TestMDRange_TileOrder functor(N0, N1, N2);
+    parallel_for(range, functor);
+    int sum = 0;
+    parallel_reduce(range, functor, sum);
+    ASSERT_EQ(sum, (N0 - 1) * N1 * (N2 - 2));
+
+    auto h_view = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      functor.input_view);
+    for (int i = 0; i < N0; ++i) {
+      for (int j = 0; j < N1; ++j) {
+        for (int k = 0; k < N2; ++k) {
+          ASSERT_EQ(h_view(i, j, k), (i >= 1 && k >= 2) ? 1 : 0);
+        }
+      }
+    }
+  }
+};
+
 }  // namespace
 
 }  // namespace Test
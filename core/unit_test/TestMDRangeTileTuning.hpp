@@ -0,0 +1,183 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+namespace {
+
+template <typename ExecSpace>
+struct TestMDRangeTileTuning {
+  using view_type   = Kokkos::View<int ***, ExecSpace>;
+  using policy_type = Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<3>>;
+  using search_type = Kokkos::Tools::Experimental::MDRangeTileSearch;
+
+  view_type m_view;
+
+  TestMDRangeTileTuning(int N0, int N1, int N2) : m_view("v", N0, N1, N2) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    m_view(i, j, k) += 1;
+  }
+
+  struct Sum {
+    view_type m_view;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int i, const int j, const int k, int &sum) const {
+      sum += m_view(i, j, k);
+    }
+  };
+
+  // The search of a kernel is keyed on its label and iteration extents
+  static std::string search_key(const std::string &label, const int N0,
+                                const int N1, const int N2) {
+    return label + " [" + std::to_string(N0) + "x" + std::to_string(N1) +
+           "x" + std::to_string(N2) + "]";
+  }
+
+  static const search_type *find_search(const std::string &key) {
+    const auto &searches =
+        Kokkos::Tools::Experimental::mdrange_tile_searches();
+    const auto iter = searches.find(key);
+    return iter == searches.end() ? nullptr : &iter->second;
+  }
+
+  static void erase_search(const std::string &key) {
+    Kokkos::Tools::Experimental::mdrange_tile_searches().erase(key);
+  }
+
+  static std::string temporary_filename() {
+#ifdef _WIN32
+    char name[L_tmpnam];
+    return std::tmpnam(name) ? name : "kokkos_mdrange_tile_cache.txt";
+#else
+    const char *dir  = std::getenv("TMPDIR");
+    std::string name = std::string(dir ? dir : "/tmp") +
+                       "/kokkos_mdrange_tile_cache_XXXXXX";
+    const int fd = mkstemp(&name[0]);
+    if (fd != -1) close(fd);
+    return name;
+#endif
+  }
+
+  static void test_tile_tuning(const int N0, const int N1, const int N2) {
+    const std::string label   = "Test::mdrange_tile_tuning";
+    const std::string key     = search_key(label, N0, N1, N2);
+    const std::string sum_key = search_key(label + "_sum", N0, N1, N2);
+    erase_search(key);
+    erase_search(sum_key);
+
+    TestMDRangeTileTuning functor(N0, N1, N2);
+    const bool host_accessible =
+        Kokkos::Impl::MemorySpaceAccess<
+            Kokkos::HostSpace, typename ExecSpace::memory_space>::accessible;
+
+    // Every launch must visit each index exactly once, whatever tile the
+    // search tries; the search has to converge in a bounded number of
+    // launches.
+    int launches = 0;
+    for (; launches < 100; ++launches) {
+      policy_type policy({0, 0, 0}, {N0, N1, N2});
+      Kokkos::parallel_for(label, policy.set_tile_tuning(true), functor);
+      const search_type *search = find_search(key);
+      if (!host_accessible) {
+        ASSERT_EQ(search, nullptr);
+      } else if (search->converged()) {
+        ++launches;
+        break;
+      }
+    }
+    if (host_accessible) {
+      ASSERT_LT(launches, 100);
+    }
+
+    int sum = 0;
+    policy_type policy({0, 0, 0}, {N0, N1, N2});
+    Kokkos::parallel_reduce(label + "_sum", policy.set_tile_tuning(true),
+                            Sum{functor.m_view}, sum);
+    ASSERT_EQ(sum, launches * N0 * N1 * N2);
+    if (!host_accessible) return;
+
+    // The learned tile fits the cache budget and survives a round trip
+    // through the tile cache file.
+    const auto best = find_search(key)->best();
+    int64_t tile_points = 1;
+    for (auto extent : best) tile_points *= extent;
+    ASSERT_EQ(best.size(), 3u);
+    ASSERT_LE(tile_points, search_type::max_tile_points);
+
+    const std::string filename = temporary_filename();
+    Kokkos::Tools::Experimental::save_mdrange_tile_cache(filename);
+    erase_search(key);
+    ASSERT_EQ(find_search(key), nullptr);
+    Kokkos::Tools::Experimental::load_mdrange_tile_cache(filename);
+    std::remove(filename.c_str());
+    ASSERT_NE(find_search(key), nullptr);
+    ASSERT_TRUE(find_search(key)->converged());
+    ASSERT_EQ(find_search(key)->best(), best);
+
+    erase_search(key);
+    erase_search(sum_key);
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, mdrange_tile_tuning) {
+  TestMDRangeTileTuning<TEST_EXECSPACE>::test_tile_tuning(9, 33, 130);
+}
+
+}  // namespace Test
@@ -50,4 +50,13 @@ TEST(TEST_CATEGORY, mdrange_scalar) {
   TestMDRange_ReduceScalar<TEST_EXECSPACE>::test_scalar_reduce(12, 11);
 }
 
+TEST(TEST_CATEGORY, mdrange_tile_order) {
+  using functor_type = TestMDRange_TileOrder<TEST_EXECSPACE>;
+  functor_type::test_morton_coordinates();
+  functor_type::test_tile_order<Iterate::Right, Iterate::Right>(13, 17, 22);
+  functor_type::test_tile_order<Iterate::Left, Iterate::Right>(13, 17, 22);
+  functor_type::test_tile_order<Iterate::Right, Iterate::Left>(9, 3, 40);
+  functor_type::test_tile_order<Iterate::Left, Iterate::Left>(9, 3, 40);
+}
+
 }  // namespace Test
@@ -51,4 +51,5 @@
 
 #include <TestViewCtorPropEmbeddedDim.hpp>
 #include <TestViewLayoutTiled.hpp>
+#include <TestViewSoA.hpp>
 #endif
@@ -0,0 +1,318 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+namespace Test {
+
+namespace {
+
+namespace KE = Kokkos::Experimental;
+
+template <class Simd>
+void fill_simd_lanes(typename Simd::value_type* a,
+                     typename Simd::value_type* b) {
+  using value_type = typename Simd::value_type;
+  for (std::size_t i = 0; i < Simd::size(); ++i) {
+    a[i] = value_type(int(i) - 3) + value_type(0.5);
+    b[i] = value_type(2 + i % 3);
+  }
+}
+
+template <class Simd>
+void test_simd_math(std::true_type) {
+  using value_type = typename Simd::value_type;
+  constexpr std::size_t n = Simd::size();
+
+  value_type a_lanes[n], b_lanes[n];
+  fill_simd_lanes<Simd>(a_lanes, b_lanes);
+  Simd a, b;
+  a.copy_from(a_lanes, KE::element_aligned_tag());
+  b.copy_from(b_lanes, KE::element_aligned_tag());
+
+  const Simd abs_a    = KE::abs(a);
+  const Simd sqrt_b   = KE::sqrt(b);
+  const Simd floor_a  = KE::floor(a);
+  const Simd ceil_a   = KE::ceil(a);
+  const Simd round_a  = KE::round(a);
+  const Simd trunc_a  = KE::trunc(a);
+  const Simd sign_ba  = KE::copysign(b, a);
+  const Simd fma_abb  = KE::fma(a, b, b);
+  const Simd min_ab   = KE::min(a, b);
+  const Simd max_ab   = KE::max(a, b);
+  const Simd exp_a    = KE::exp(a);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(abs_a[i], std::abs(a_lanes[i]));
+    EXPECT_EQ(sqrt_b[i], std::sqrt(b_lanes[i]));
+    EXPECT_EQ(floor_a[i], std::floor(a_lanes[i]));
+    EXPECT_EQ(ceil_a[i], std::ceil(a_lanes[i]));
+    EXPECT_EQ(round_a[i], std::round(a_lanes[i]));
+    EXPECT_EQ(trunc_a[i], std::trunc(a_lanes[i]));
+    EXPECT_EQ(sign_ba[i], std::copysign(b_lanes[i], a_lanes[i]));
+    EXPECT_EQ(fma_abb[i], std::fma(a_lanes[i], b_lanes[i], b_lanes[i]));
+    EXPECT_EQ(min_ab[i], std::min(a_lanes[i], b_lanes[i]));
+    EXPECT_EQ(max_ab[i], std::max(a_lanes[i], b_lanes[i]));
+    EXPECT_EQ(exp_a[i], value_type(std::exp(a_lanes[i])));
+  }
+
+  const Simd neg_zero = -Simd(value_type(0));
+  EXPECT_TRUE(std::signbit(neg_zero[0]));
+}
+
+template <class Simd>
+void test_simd_math(std::false_type) {}
+
+template <class Simd>
+void test_simd() {
+  using value_type = typename Simd::value_type;
+  using mask_type  = typename Simd::mask_type;
+  constexpr std::size_t n = Simd::size();
+
+  value_type a_lanes[n], b_lanes[n];
+  fill_simd_lanes<Simd>(a_lanes, b_lanes);
+
+  Simd a, b;
+  a.copy_from(a_lanes, KE::element_aligned_tag());
+  b.copy_from(b_lanes, KE::element_aligned_tag());
+  const Simd lanes([](std::size_t i) { return value_type(i); });
+
+  const Simd sum        = a + b;
+  const Simd difference = a - b;
+  const Simd product    = a * b;
+  const Simd quotient   = a / b;
+  const Simd negation   = -a;
+  Simd accumulated      = a;
+  accumulated += b;
+  accumulated *= value_type(2);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(a[i], a_lanes[i]);
+    EXPECT_EQ(lanes[i], value_type(i));
+    EXPECT_EQ(sum[i], value_type(a_lanes[i] + b_lanes[i]));
+    EXPECT_EQ(difference[i], value_type(a_lanes[i] - b_lanes[i]));
+    EXPECT_EQ(product[i], value_type(a_lanes[i] * b_lanes[i]));
+    EXPECT_EQ(quotient[i], value_type(a_lanes[i] / b_lanes[i]));
+    EXPECT_EQ(negation[i], value_type(-a_lanes[i]));
+    EXPECT_EQ(accumulated[i], value_type(2 * (a_lanes[i] + b_lanes[i])));
+  }
+
+  // Comparisons and mask logic.
+  const mask_type less     = a < b;
+  const mask_type greater  = a > b;
+  const mask_type equal    = a == a;
+  const mask_type not_less = !less;
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(less[i], a_lanes[i] < b_lanes[i]);
+    EXPECT_EQ((a <= b)[i], a_lanes[i] <= b_lanes[i]);
+    EXPECT_EQ(greater[i], a_lanes[i] > b_lanes[i]);
+    EXPECT_EQ((a >= b)[i], a_lanes[i] >= b_lanes[i]);
+    EXPECT_EQ((a != b)[i], a_lanes[i] != b_lanes[i]);
+    EXPECT_EQ(not_less[i], !(a_lanes[i] < b_lanes[i]));
+    EXPECT_FALSE((less && not_less)[i]);
+    EXPECT_TRUE((less || not_less)[i]);
+    EXPECT_TRUE((less != not_less)[i]);
+    EXPECT_FALSE((less == not_less)[i]);
+  }
+  EXPECT_TRUE(KE::all_of(equal));
+  EXPECT_TRUE(KE::any_of(equal));
+  EXPECT_FALSE(KE::none_of(equal));
+  EXPECT_FALSE(KE::any_of(!equal));
+  EXPECT_TRUE(KE::none_of(mask_type(false)));
+  EXPECT_TRUE(KE::all_of(mask_type(true)));
+  EXPECT_EQ(KE::any_of(less), a_lanes[0] < b_lanes[0]);
+
+  // Where-expressions change only the selected lanes.
+  Simd selected = b;
+  KE::where(less, selected) = a;
+  const Simd chosen = KE::condition(less, a, b);
+  Simd incremented  = a;
+  KE::where(greater, incremented) += value_type(1);
+  for (std::size_t i = 0; i < n; ++i) {
+    const bool l = a_lanes[i] < b_lanes[i];
+    EXPECT_EQ(selected[i], l ? a_lanes[i] : b_lanes[i]);
+    EXPECT_EQ(chosen[i], l ? a_lanes[i] : b_lanes[i]);
+    EXPECT_EQ(incremented[i], a_lanes[i] > b_lanes[i] ? a_lanes[i] + 1
+                                                       : a_lanes[i]);
+  }
+
+  // Masked memory access touches only the selected lanes.
+  const mask_type even([](std::size_t i) { return i % 2 == 0; });
+  value_type out[n];
+  for (std::size_t i = 0; i < n; ++i) out[i] = value_type(-7);
+  KE::where(even, a).copy_to(out, KE::element_aligned_tag());
+  Simd loaded = b;
+  KE::where(even, loaded).copy_from(a_lanes, KE::element_aligned_tag());
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(out[i], i % 2 == 0 ? a_lanes[i] : value_type(-7));
+    EXPECT_EQ(loaded[i], i % 2 == 0 ? a_lanes[i] : b_lanes[i]);
+  }
+
+  // Reductions.
+  value_type total = 0, low = a_lanes[0], high = a_lanes[0];
+  for (std::size_t i = 0; i < n; ++i) {
+    total += a_lanes[i];
+    low  = std::min(low, a_lanes[i]);
+    high = std::max(high, a_lanes[i]);
+  }
+  EXPECT_EQ(KE::reduce(a), total);
+  EXPECT_EQ(KE::hmin(a), low);
+  EXPECT_EQ(KE::hmax(a), high);
+
+  // Lane-wise conversion.
+  using int_simd = KE::simd<std::int32_t, typename Simd::abi_type>;
+  const int_simd truncated(KE::trunc(b));
+  const Simd round_trip(truncated);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(truncated[i], std::int32_t(b_lanes[i]));
+    EXPECT_EQ(round_trip[i], value_type(std::int32_t(b_lanes[i])));
+  }
+
+  test_simd_math<Simd>(std::is_floating_point<value_type>());
+}
+
+template <class Simd>
+void test_simd_view() {
+  using value_type = typename Simd::value_type;
+  using exec_space = typename std::conditional<
+      Kokkos::SpaceAccessibility<TEST_EXECSPACE, Kokkos::HostSpace>::accessible,
+      TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>::type;
+  constexpr int n = Simd::size();
+
+  // An extent that is not a multiple of the lane count, followed by
+  // guard elements the tail of the loop must not touch.
+  const int extent = 5 * n + (n > 1 ? n - 1 : 0);
+  Kokkos::View<value_type*, Kokkos::HostSpace> x_all("x", extent + n);
+  Kokkos::View<value_type*, Kokkos::HostSpace> y_all("y", extent + n);
+  for (int i = 0; i < extent + n; ++i) {
+    x_all(i) = value_type(i % 17);
+    y_all(i) = value_type(1);
+  }
+  auto x = Kokkos::subview(x_all, Kokkos::make_pair(0, extent));
+  auto y = Kokkos::subview(y_all, Kokkos::make_pair(0, extent));
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, (extent + n - 1) / n), [=](int c) {
+        const std::size_t i = std::size_t(c) * n;
+        const Simd xs       = KE::simd_load<Simd>(x, i);
+        const Simd ys       = KE::simd_load<Simd>(y, i);
+        KE::simd_store(value_type(2) * xs + ys, y, i);
+      });
+  exec_space().fence();
+
+  for (int i = 0; i < extent; ++i) {
+    ASSERT_EQ(y_all(i), value_type(2 * (i % 17) + 1));
+  }
+  for (int i = extent; i < extent + n; ++i) {
+    ASSERT_EQ(y_all(i), value_type(1));
+  }
+
+  // Lanes past the extent load as zero.
+  const Simd tail = KE::simd_load<Simd>(x, extent - 1);
+  EXPECT_EQ(tail[0], x(extent - 1));
+  for (int i = 1; i < n; ++i) EXPECT_EQ(tail[i], value_type(0));
+
+  // Indices at or past the extent load nothing and store nothing.
+  for (const int i : {extent, extent + n}) {
+    const Simd past = KE::simd_load<Simd>(x, i);
+    for (int lane = 0; lane < n; ++lane) {
+      EXPECT_EQ(past[lane], value_type(0));
+    }
+    KE::simd_store(Simd(value_type(7)), y, i);
+  }
+  for (int i = extent; i < extent + n; ++i) {
+    ASSERT_EQ(y_all(i), value_type(1));
+  }
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, simd_scalar) {
+  test_simd<KE::simd<double, KE::simd_abi::scalar> >();
+  test_simd<KE::simd<float, KE::simd_abi::scalar> >();
+  test_simd<KE::simd<std::int32_t, KE::simd_abi::scalar> >();
+}
+
+TEST(TEST_CATEGORY, simd_fixed_size) {
+  test_simd<KE::simd<double, KE::simd_abi::fixed_size<5> > >();
+  test_simd<KE::simd<float, KE::simd_abi::fixed_size<3> > >();
+  test_simd<KE::simd<std::int64_t, KE::simd_abi::fixed_size<4> > >();
+}
+
+TEST(TEST_CATEGORY, simd_native) {
+  test_simd<KE::simd<double, KE::simd_abi::native<double> > >();
+  test_simd<KE::simd<float, KE::simd_abi::native<float> > >();
+}
+
+#if defined(KOKKOS_IMPL_SIMD_AVX2)
+TEST(TEST_CATEGORY, simd_avx2) {
+  test_simd<KE::simd<double, KE::simd_abi::avx2_fixed_size<4> > >();
+  test_simd<KE::simd<float, KE::simd_abi::avx2_fixed_size<8> > >();
+}
+#endif
+
+#if defined(KOKKOS_IMPL_SIMD_AVX512)
+TEST(TEST_CATEGORY, simd_avx512) {
+  test_simd<KE::simd<double, KE::simd_abi::avx512_fixed_size<8> > >();
+  test_simd<KE::simd<float, KE::simd_abi::avx512_fixed_size<16> > >();
+}
+#endif
+
+#if defined(KOKKOS_IMPL_SIMD_NEON)
+TEST(TEST_CATEGORY, simd_neon) {
+  test_simd<KE::simd<double, KE::simd_abi::neon_fixed_size<2> > >();
+  test_simd<KE::simd<float, KE::simd_abi::neon_fixed_size<4> > >();
+}
+#endif
+
+TEST(TEST_CATEGORY, simd_view) {
+  test_simd_view<KE::simd<double, KE::simd_abi::native<double> > >();
+  test_simd_view<KE::simd<float, KE::simd_abi::native<float> > >();
+  test_simd_view<KE::simd<double, KE::simd_abi::fixed_size<3> > >();
+  test_simd_view<KE::simd<double, KE::simd_abi::scalar> >();
+}
+
+}  // namespace Test
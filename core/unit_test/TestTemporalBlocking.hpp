@@ -0,0 +1,127 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+namespace {
+
+// Jacobi-style smoothing that reads step - 1 from one View and writes step
+// into the other, depending on the parity of step
+template <class ViewType>
+struct TimeStepJacobi {
+  ViewType a;
+  ViewType b;
+  int halo;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int step, const int i, const int j) const {
+    const ViewType& src = step % 2 == 0 ? a : b;
+    const ViewType& dst = step % 2 == 0 ? b : a;
+    double sum          = src(i, j);
+    for (int r = 1; r <= halo; ++r) {
+      sum += src(i - r, j) + src(i + r, j) + src(i, j - r) + src(i, j + r);
+    }
+    dst(i, j) = sum / (4 * halo + 1);
+  }
+};
+
+template <class ExecSpace, Kokkos::Iterate Direction>
+struct TestTemporalBlocking {
+  using view_type   = Kokkos::View<double **, ExecSpace>;
+  using policy_type = Kokkos::MDRangePolicy<
+      ExecSpace, Kokkos::Rank<2, Direction, Direction>, Kokkos::IndexType<int>>;
+
+  static view_type run(const int N0, const int N1, const int halo,
+                       const int num_steps, const int fused_steps) {
+    view_type a("a", N0 + 2 * halo, N1 + 2 * halo);
+    view_type b("b", N0 + 2 * halo, N1 + 2 * halo);
+    auto h_a = Kokkos::create_mirror_view(a);
+    for (int i = 0; i < N0 + 2 * halo; ++i) {
+      for (int j = 0; j < N1 + 2 * halo; ++j) {
+        h_a(i, j) = (i * 7 + j * 13) % 17;
+      }
+    }
+    Kokkos::deep_copy(a, h_a);
+    Kokkos::deep_copy(b, h_a);
+
+    policy_type policy({halo, halo}, {N0 + halo, N1 + halo});
+    Kokkos::Experimental::parallel_for_time_steps(
+        "Test::temporal_blocking", policy, num_steps, halo, fused_steps,
+        TimeStepJacobi<view_type>{a, b, halo});
+    return num_steps % 2 == 0 ? a : b;
+  }
+
+  static void test(const int N0, const int N1, const int halo,
+                   const int num_steps, const int fused_steps) {
+    auto expected = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), run(N0, N1, halo, num_steps, 1));
+    auto result = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), run(N0, N1, halo, num_steps, fused_steps));
+
+    for (int i = 0; i < N0 + 2 * halo; ++i) {
+      for (int j = 0; j < N1 + 2 * halo; ++j) {
+        ASSERT_EQ(result(i, j), expected(i, j)) << i << " " << j;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, temporal_blocking) {
+  using right = TestTemporalBlocking<TEST_EXECSPACE, Kokkos::Iterate::Right>;
+  using left  = TestTemporalBlocking<TEST_EXECSPACE, Kokkos::Iterate::Left>;
+
+  right::test(37, 11, 1, 7, 3);
+  right::test(37, 11, 2, 9, 4);
+  right::test(5, 11, 1, 5, 8);
+  left::test(11, 37, 1, 7, 3);
+  left::test(11, 40, 2, 10, 5);
+}
+
+}  // namespace Test
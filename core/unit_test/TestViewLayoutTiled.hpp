@@ -1753,6 +1753,215 @@ struct TestViewLayoutTiled {
 
   }  // end test_view_layout_tiled_subtile_4d
 
+#if !defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+  template <class LayoutType>
+  static void test_view_layout_tiled_subview_2d(const int, const int) {
+#else
+  template <class LayoutType>
+  static void test_view_layout_tiled_subview_2d(const int N0, const int N1) {
+    using ViewType = Kokkos::View<Scalar**, LayoutType, ExecSpace>;
+    using HostRight =
+        Kokkos::View<Scalar**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+    const int TN0 = LayoutType::N0;
+    const int TN1 = LayoutType::N1;
+
+    ViewType v("v", N0, N1);
+
+    // Fill through the storage tile policy
+    auto policy = Kokkos::Experimental::layout_tiled_policy(v);
+    ASSERT_EQ(policy.m_tile[0], TN0);
+    ASSERT_EQ(policy.m_tile[1], TN1);
+    ASSERT_EQ(policy.m_num_tiles,
+              ((N0 + TN0 - 1) / TN0) * ((N1 + TN1 - 1) / TN1));
+    Kokkos::parallel_for(
+        "ViewTile rank 2 fill", policy,
+        KOKKOS_LAMBDA(const int i, const int j) { v(i, j) = i * N1 + j; });
+
+    // Tiled to strided conversion
+    {
+      Kokkos::View<Scalar**, Kokkos::LayoutRight, ExecSpace> r("r", N0, N1);
+      Kokkos::deep_copy(r, v);
+      HostRight hr =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+      long counter = 0;
+      for (int i = 0; i < N0; ++i)
+        for (int j = 0; j < N1; ++j)
+          if (hr(i, j) != i * N1 + j) ++counter;
+      ASSERT_EQ(counter, long(0));
+    }
+
+    // Whole tiles of the slowest varying tile dimension stay contiguous
+    {
+      const bool outer_left =
+          LayoutType::outer_pattern == Kokkos::Iterate::Left;
+      auto slab =
+          outer_left
+              ? Kokkos::subview(v, Kokkos::make_pair(0, N0),
+                                Kokkos::make_pair(TN1, N1))
+              : Kokkos::subview(v, Kokkos::make_pair(TN0, N0),
+                                Kokkos::make_pair(0, N1));
+      ASSERT_TRUE(slab.span_is_contiguous());
+
+      ViewType w("w", slab.extent(0), slab.extent(1));
+      ASSERT_EQ(w.span(), slab.span());
+      Kokkos::deep_copy(w, slab);
+      Kokkos::View<Scalar**, Kokkos::LayoutRight, ExecSpace> r(
+          "r", w.extent(0), w.extent(1));
+      Kokkos::deep_copy(r, w);
+      HostRight hr =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+      const int i0 = outer_left ? 0 : TN0;
+      const int j0 = outer_left ? TN1 : 0;
+      long counter = 0;
+      for (int i = 0; i < int(hr.extent(0)); ++i)
+        for (int j = 0; j < int(hr.extent(1)); ++j)
+          if (hr(i, j) != (i + i0) * N1 + (j + j0)) ++counter;
+      ASSERT_EQ(counter, long(0));
+    }
+    // Box of whole tiles, ending at the extent in the last dimension
+    {
+      auto sub = Kokkos::subview(v, Kokkos::make_pair(TN0, 3 * TN0),
+                                 Kokkos::make_pair(TN1, N1));
+      static_assert(std::is_same<typename decltype(sub)::array_layout,
+                                 LayoutType>::value,
+                    "tile aligned subview keeps the tiled layout");
+      ASSERT_EQ(sub.extent(0), size_t(2 * TN0));
+      ASSERT_EQ(sub.extent(1), size_t(N1 - TN1));
+      ASSERT_FALSE(sub.span_is_contiguous());
+
+      Kokkos::View<Scalar**, Kokkos::LayoutLeft, ExecSpace> l(
+          "l", sub.extent(0), sub.extent(1));
+      Kokkos::deep_copy(l, sub);
+      auto hl = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), l);
+      long counter = 0;
+      for (int i = 0; i < int(hl.extent(0)); ++i)
+        for (int j = 0; j < int(hl.extent(1)); ++j)
+          if (hl(i, j) != (i + TN0) * N1 + (j + TN1)) ++counter;
+      ASSERT_EQ(counter, long(0));
+
+      // Strided to tiled conversion must leave the rest of v untouched
+      Kokkos::deep_copy(l, Scalar(-1));
+      Kokkos::deep_copy(sub, l);
+      Kokkos::View<Scalar**, Kokkos::LayoutRight, ExecSpace> r("r", N0, N1);
+      Kokkos::deep_copy(r, v);
+      HostRight hv =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+      for (int i = 0; i < N0; ++i) {
+        for (int j = 0; j < N1; ++j) {
+          const bool inside = TN0 <= i && i < 3 * TN0 && TN1 <= j;
+          if (hv(i, j) != (inside ? Scalar(-1) : Scalar(i * N1 + j)))
+            ++counter;
+        }
+      }
+      ASSERT_EQ(counter, long(0));
+    }
+
+#endif
+  }  // end test_view_layout_tiled_subview_2d
+
+#if !defined(KOKKOS_ENABLE_CXX11_DISPATCH_LAMBDA)
+  template <class LayoutType>
+  static void test_view_layout_tiled_subview_3d(const int, const int,
+                                                const int) {
+#else
+  template <class LayoutType>
+  static void test_view_layout_tiled_subview_3d(const int N0, const int N1,
+                                                const int N2) {
+    using ViewType = Kokkos::View<Scalar***, LayoutType, ExecSpace>;
+    using RightType =
+        Kokkos::View<Scalar***, Kokkos::LayoutRight, ExecSpace>;
+
+    const int TN0 = LayoutType::N0;
+    const int TN1 = LayoutType::N1;
+    const int TN2 = LayoutType::N2;
+
+    ViewType v("v", N0, N1, N2);
+
+    // Fill through the storage tile policy
+    auto policy = Kokkos::Experimental::layout_tiled_policy(v);
+    ASSERT_EQ(policy.m_num_tiles, ((N0 + TN0 - 1) / TN0) *
+                                      ((N1 + TN1 - 1) / TN1) *
+                                      ((N2 + TN2 - 1) / TN2));
+    Kokkos::parallel_for(
+        "ViewTile rank 3 fill", policy,
+        KOKKOS_LAMBDA(const int i, const int j, const int k) {
+          v(i, j, k) = (i * N1 + j) * N2 + k;
+        });
+
+    // Whole tiles of the slowest varying tile dimension stay contiguous
+    {
+      const bool outer_left =
+          LayoutType::outer_pattern == Kokkos::Iterate::Left;
+      const int i0 = outer_left ? 0 : TN0;
+      const int k0 = outer_left ? TN2 : 0;
+
+      auto slab = Kokkos::subview(v, Kokkos::make_pair(i0, N0),
+                                  Kokkos::make_pair(0, N1),
+                                  Kokkos::make_pair(k0, N2));
+      ASSERT_TRUE(slab.span_is_contiguous());
+
+      ViewType w("w", slab.extent(0), slab.extent(1), slab.extent(2));
+      ASSERT_EQ(w.span(), slab.span());
+      Kokkos::deep_copy(w, slab);
+      RightType r("r", w.extent(0), w.extent(1), w.extent(2));
+      Kokkos::deep_copy(r, w);
+      auto hr = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+      long counter = 0;
+      for (int i = 0; i < int(hr.extent(0)); ++i)
+        for (int j = 0; j < int(hr.extent(1)); ++j)
+          for (int k = 0; k < int(hr.extent(2)); ++k)
+            if (hr(i, j, k) != ((i + i0) * N1 + j) * N2 + (k + k0)) ++counter;
+      ASSERT_EQ(counter, long(0));
+    }
+    // Box of whole tiles, ending at the extent in the middle dimension
+    {
+      auto sub = Kokkos::subview(v, Kokkos::make_pair(TN0, 3 * TN0),
+                                 Kokkos::make_pair(TN1, N1),
+                                 Kokkos::make_pair(0, 2 * TN2));
+      static_assert(std::is_same<typename decltype(sub)::array_layout,
+                                 LayoutType>::value,
+                    "tile aligned subview keeps the tiled layout");
+      ASSERT_EQ(sub.extent(0), size_t(2 * TN0));
+      ASSERT_EQ(sub.extent(1), size_t(N1 - TN1));
+      ASSERT_EQ(sub.extent(2), size_t(2 * TN2));
+      ASSERT_FALSE(sub.span_is_contiguous());
+
+      Kokkos::View<Scalar***, Kokkos::LayoutLeft, ExecSpace> l(
+          "l", sub.extent(0), sub.extent(1), sub.extent(2));
+      Kokkos::deep_copy(l, sub);
+      auto hl = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), l);
+      long counter = 0;
+      for (int i = 0; i < int(hl.extent(0)); ++i)
+        for (int j = 0; j < int(hl.extent(1)); ++j)
+          for (int k = 0; k < int(hl.extent(2)); ++k)
+            if (hl(i, j, k) != ((i + TN0) * N1 + (j + TN1)) * N2 + k)
+              ++counter;
+      ASSERT_EQ(counter, long(0));
+
+      // Strided to tiled conversion must leave the rest of v untouched
+      Kokkos::deep_copy(l, Scalar(-1));
+      Kokkos::deep_copy(sub, l);
+      RightType r("r", N0, N1, N2);
+      Kokkos::deep_copy(r, v);
+      auto hv = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r);
+      for (int i = 0; i < N0; ++i) {
+        for (int j = 0; j < N1; ++j) {
+          for (int k = 0; k < N2; ++k) {
+            const bool inside =
+                TN0 <= i && i < 3 * TN0 && TN1 <= j && k < 2 * TN2;
+            if (hv(i, j, k) !=
+                (inside ? Scalar(-1) : Scalar((i * N1 + j) * N2 + k)))
+              ++counter;
+          }
+        }
+      }
+      ASSERT_EQ(counter, long(0));
+    }
+
+#endif
+  }  // end test_view_layout_tiled_subview_3d
+
 };  // end TestViewLayoutTiled struct
 
 }  // namespace
@@ -1775,4 +1984,25 @@ TEST(TEST_CATEGORY, view_layouttiled_subtile) {
   TestViewLayoutTiled<TEST_EXECSPACE>::test_view_layout_tiled_subtile_4d(
       4, 12, 16, 12);
 }
+TEST(TEST_CATEGORY, view_layouttiled_subview) {
+  using TestLT = TestViewLayoutTiled<TEST_EXECSPACE>;
+  TestLT::test_view_layout_tiled_subview_2d<TestLT::LayoutLL_2D_2x4>(10, 13);
+  TestLT::test_view_layout_tiled_subview_2d<TestLT::LayoutRL_2D_2x4>(10, 13);
+  TestLT::test_view_layout_tiled_subview_2d<TestLT::LayoutLR_2D_2x4>(10, 13);
+  TestLT::test_view_layout_tiled_subview_2d<TestLT::LayoutRR_2D_2x4>(10, 13);
+  TestLT::test_view_layout_tiled_subview_3d<TestLT::LayoutLL_3D_2x4x4>(7, 9,
+                                                                     11);
+  TestLT::test_view_layout_tiled_subview_3d<TestLT::LayoutRL_3D_2x4x4>(7, 9,
+                                                                     11);
+  TestLT::test_view_layout_tiled_subview_3d<TestLT::LayoutLR_3D_2x4x4>(7, 9,
+                                                                     11);
+  TestLT::test_view_layout_tiled_subview_3d<TestLT::LayoutRR_3D_2x4x4>(7, 9,
+                                                                     11);
+
+  Kokkos::View<double****, TestLT::LayoutRR_4D_2x4x4x2, Kokkos::HostSpace> v(
+      "v", 3, 5, 7, 9);
+  for (int r = 0; r < 4; ++r) {
+    ASSERT_EQ(v.layout().dimension[r], v.extent(r));
+  }
+}
 }  // namespace Test
@@ -0,0 +1,178 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_ViewSoA.hpp>
+
+namespace Test {
+
+namespace {
+
+struct SoAParticle {
+  double x;
+  double y;
+  double z;
+  int id;
+};
+
+template <typename ExecSpace, unsigned VectorLength>
+struct TestViewSoA {
+  using layout_type = Kokkos::Experimental::LayoutSoA<VectorLength>;
+  using view_type   = Kokkos::View<SoAParticle*, layout_type, ExecSpace>;
+  using host_type   = typename view_type::HostMirror;
+
+  static SoAParticle make(const int i) {
+    return SoAParticle{1.0 * i, 2.0 * i, 3.0 * i, i};
+  }
+
+  static void check(const SoAParticle& p, const int i, const double scale) {
+    ASSERT_EQ(p.x, scale * i);
+    ASSERT_EQ(p.y, 2.0 * scale * i);
+    ASSERT_EQ(p.z, 3.0 * scale * i);
+    ASSERT_EQ(p.id, i);
+  }
+
+  static void test(const int N) {
+    view_type v("v", N);
+
+    ASSERT_EQ(v.extent(0), size_t(N));
+    ASSERT_TRUE(v.span_is_contiguous());
+
+    {
+      host_type h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+      for (int i = 0; i < N; ++i) {
+        const SoAParticle p = h(i);
+        ASSERT_EQ(p.x, 0.0);
+        ASSERT_EQ(p.id, 0);
+      }
+    }
+
+    // Whole element writes and single member updates in a kernel
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, N), KOKKOS_LAMBDA(const int i) {
+          v(i) = SoAParticle{0.5 * i, 1.0 * i, 1.5 * i, i};
+          (v(i)->*&SoAParticle::x) *= 2.0;
+          (v(i)->*&SoAParticle::y) *= 2.0;
+          (v(i)->*&SoAParticle::z) *= 2.0;
+        });
+
+    host_type h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    for (int i = 0; i < N; ++i) check(h(i), i, 1.0);
+
+    // Members are stored in per-word streams
+    const double* const raw = reinterpret_cast<const double*>(h.data());
+    for (int i = 0; i < N; ++i) {
+      const int b = VectorLength ? i / VectorLength : 0;
+      const int l = VectorLength ? i % VectorLength : i;
+      const int s = VectorLength ? VectorLength : N;
+      ASSERT_EQ(raw[b * 4 * s + 0 * s + l], 1.0 * i);
+      ASSERT_EQ(raw[b * 4 * s + 1 * s + l], 2.0 * i);
+      ASSERT_EQ(raw[b * 4 * s + 2 * s + l], 3.0 * i);
+    }
+
+    // Transpose to and from an array of structures
+    Kokkos::View<SoAParticle*, ExecSpace> aos("aos", N);
+    Kokkos::deep_copy(aos, v);
+    auto h_aos = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aos);
+    for (int i = 0; i < N; ++i) check(h_aos(i), i, 1.0);
+
+    for (int i = 0; i < N; ++i) h_aos(i) = make(i), h_aos(i).x *= 3.0;
+    Kokkos::deep_copy(aos, h_aos);
+    Kokkos::deep_copy(v, aos);
+    Kokkos::deep_copy(h, v);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(h(i)->*&SoAParticle::x, 3.0 * i);
+      ASSERT_EQ(h(i)->*&SoAParticle::id, i);
+    }
+
+    // Member streams as ordinary views
+    auto x  = Kokkos::subview(h, &SoAParticle::x);
+    auto id = Kokkos::subview(h, &SoAParticle::id);
+    ASSERT_EQ(x.use_count(), h.use_count());
+    for (int i = 0; i < N; ++i) {
+      // (block, lane) for AoSoA, extra index ignored for SoA
+      const int b = VectorLength ? i / VectorLength : i;
+      const int l = VectorLength ? i % VectorLength : 0;
+      ASSERT_EQ(x.access(b, l), 3.0 * i);
+      ASSERT_EQ(id.access(b, l), i);
+    }
+
+    // Range subviews
+    const int begin = VectorLength ? VectorLength : 3;
+    auto s          = Kokkos::subview(h, std::make_pair(begin, N));
+    ASSERT_EQ(s.extent(0), size_t(N - begin));
+    ASSERT_EQ(s.span_is_contiguous(), VectorLength != 0);
+    for (int j = 0; j < N - begin; ++j) {
+      ASSERT_EQ(s(j)->*&SoAParticle::id, begin + j);
+    }
+    s(0) = make(-1);
+    check(h(begin), -1, 1.0);
+
+    typename host_type::const_type c = s;
+    ASSERT_EQ(c(0)->*&SoAParticle::id, -1);
+
+    host_type copy("copy", N - begin);
+    Kokkos::deep_copy(copy, s);
+    for (int j = 0; j < N - begin; ++j) {
+      ASSERT_EQ(copy(j)->*&SoAParticle::id, h(begin + j)->*&SoAParticle::id);
+    }
+
+    // Fill
+    Kokkos::deep_copy(v, make(7));
+    Kokkos::deep_copy(h, v);
+    for (int i = 0; i < N; ++i) check(h(i), 7, 1.0);
+  }
+};
+
+}  // namespace
+
+TEST(TEST_CATEGORY, view_layout_soa) {
+  TestViewSoA<TEST_EXECSPACE, 0>::test(13);
+  TestViewSoA<TEST_EXECSPACE, 4>::test(13);
+  TestViewSoA<TEST_EXECSPACE, 8>::test(16);
+}
+
+}  // namespace Test